@@ -319,8 +319,12 @@ H5C_create(size_t		      max_cache_size,
 	cache_ptr->slist_ring_size[i]		= (size_t)0;
     } /* end for */
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++)
-        (cache_ptr->index)[i] = NULL;
+    if(NULL == (cache_ptr->index = (H5C_cache_entry_t **)H5MM_calloc(H5C__HASH_TABLE_LEN * sizeof(H5C_cache_entry_t *))))
+	HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed")
+    cache_ptr->index_nbuckets			= H5C__HASH_TABLE_LEN;
+    cache_ptr->index_mask			= (size_t)(H5C__HASH_TABLE_LEN - 1);
+    cache_ptr->index_split			= 0;
+    cache_ptr->index_alloc			= H5C__HASH_TABLE_LEN;
 
     cache_ptr->il_len				= 0;
     cache_ptr->il_size				= (size_t)0;
@@ -490,6 +494,8 @@ done:
             if(cache_ptr->tag_list != NULL)
                 H5SL_close(cache_ptr->tag_list);
 
+            cache_ptr->index = (H5C_cache_entry_t **)H5MM_xfree(cache_ptr->index);
+
             cache_ptr->magic = 0;
             cache_ptr = H5FL_FREE(H5C_t, cache_ptr);
         } /* end if */
@@ -879,6 +885,8 @@ H5C_dest(H5F_t * f, hid_t dxpl_id)
     cache_ptr->magic = 0;
 #endif /* NDEBUG */
 
+    cache_ptr->index = (H5C_cache_entry_t **)H5MM_xfree(cache_ptr->index);
+
     cache_ptr = H5FL_FREE(H5C_t, cache_ptr);
 
 done:
@@ -7793,6 +7801,189 @@ H5C_entry_in_skip_list(H5C_t * cache_ptr, H5C_cache_entry_t *target_ptr)
 } /* H5C_entry_in_skip_list() */
 #endif /* H5C_DO_SLIST_SANITY_CHECKS */
 
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__index_split
+ *
+ * Purpose:     Adds a bucket to the index, by splitting the bucket at
+ *		index_split in two: the entries whose address has the
+ *		next bit above index_mask set move to the new bucket at
+ *		index_split + index_mask + 1.  When all the buckets of
+ *		the current level have been split, the next level begins,
+ *		and the index array is doubled in size if need be.
+ *
+ *		Called from H5C__INSERT_IN_INDEX when the index holds more
+ *		entries than buckets.
+ *
+ * Return:      FAIL if error is detected, SUCCEED otherwise.
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5C__index_split(H5C_t *cache_ptr)
+{
+    H5C_cache_entry_t *entry_ptr;
+    H5C_cache_entry_t *next_ptr;
+    H5C_cache_entry_t *old_tail = NULL;
+    H5C_cache_entry_t *new_tail = NULL;
+    size_t new_mask;
+    uint32_t old_bucket, new_bucket;
+    herr_t ret_value = SUCCEED;
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->index_nbuckets == cache_ptr->index_mask + 1 + cache_ptr->index_split);
+
+    old_bucket = cache_ptr->index_split;
+    new_bucket = (uint32_t)(cache_ptr->index_mask + 1) + old_bucket;
+    new_mask = (cache_ptr->index_mask << 1) | 1;
+
+    /* Make room for the buckets of the next level, if we are just starting
+     * on this one.
+     */
+    if(new_bucket >= cache_ptr->index_alloc) {
+        H5C_cache_entry_t **new_index;
+        uint32_t new_alloc = 2 * cache_ptr->index_alloc;
+
+        HDassert(new_bucket < new_alloc);
+        if(NULL == (new_index = (H5C_cache_entry_t **)H5MM_realloc(cache_ptr->index, new_alloc * sizeof(H5C_cache_entry_t *))))
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, FAIL, "can't grow cache index")
+        HDmemset(new_index + cache_ptr->index_alloc, 0, (new_alloc - cache_ptr->index_alloc) * sizeof(H5C_cache_entry_t *));
+        cache_ptr->index = new_index;
+        cache_ptr->index_alloc = new_alloc;
+    } /* end if */
+
+    /* Divide the entries of the old bucket between the two buckets,
+     * keeping their order in the chain
+     */
+    entry_ptr = cache_ptr->index[old_bucket];
+    cache_ptr->index[old_bucket] = NULL;
+    HDassert(cache_ptr->index[new_bucket] == NULL);
+    while(entry_ptr) {
+        next_ptr = entry_ptr->ht_next;
+        if((H5C__HASH_KEY(entry_ptr->addr) & new_mask) == new_bucket) {
+            entry_ptr->ht_prev = new_tail;
+            if(new_tail)
+                new_tail->ht_next = entry_ptr;
+            else
+                cache_ptr->index[new_bucket] = entry_ptr;
+            new_tail = entry_ptr;
+        } /* end if */
+        else {
+            HDassert((H5C__HASH_KEY(entry_ptr->addr) & new_mask) == old_bucket);
+            entry_ptr->ht_prev = old_tail;
+            if(old_tail)
+                old_tail->ht_next = entry_ptr;
+            else
+                cache_ptr->index[old_bucket] = entry_ptr;
+            old_tail = entry_ptr;
+        } /* end else */
+        entry_ptr = next_ptr;
+    } /* end while */
+    if(new_tail)
+        new_tail->ht_next = NULL;
+    if(old_tail)
+        old_tail->ht_next = NULL;
+
+    /* Advance the split pointer, moving to the next level when all of the
+     * buckets of this level have been split
+     */
+    cache_ptr->index_nbuckets++;
+    if(++cache_ptr->index_split > cache_ptr->index_mask) {
+        cache_ptr->index_mask = new_mask;
+        cache_ptr->index_split = 0;
+    } /* end if */
+
+    H5C__UPDATE_STATS_FOR_HT_SPLIT(cache_ptr)
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5C__index_split() */
+
+
+/*-------------------------------------------------------------------------
+ *
+ * Function:    H5C__index_merge
+ *
+ * Purpose:     Removes a bucket from the index, by appending the entries
+ *		of the last bucket to the bucket it was split from.  This
+ *		undoes the last H5C__index_split().  When a level is
+ *		emptied, the index array is shrunk if it is much larger
+ *		than needed.
+ *
+ *		Called from H5C__DELETE_FROM_INDEX when the index holds
+ *		few entries for its number of buckets.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5C__index_merge(H5C_t *cache_ptr)
+{
+    H5C_cache_entry_t *entry_ptr;
+    uint32_t old_bucket, new_bucket;
+
+    FUNC_ENTER_PACKAGE_NOERR
+
+    /* Sanity checks */
+    HDassert(cache_ptr);
+    HDassert(cache_ptr->magic == H5C__H5C_T_MAGIC);
+    HDassert(cache_ptr->index_nbuckets > H5C__HASH_TABLE_LEN);
+    HDassert(cache_ptr->index_nbuckets == cache_ptr->index_mask + 1 + cache_ptr->index_split);
+
+    /* Step back to the previous level, if no buckets of this one have been
+     * split
+     */
+    if(cache_ptr->index_split == 0) {
+        cache_ptr->index_mask >>= 1;
+        cache_ptr->index_split = (uint32_t)(cache_ptr->index_mask + 1);
+    } /* end if */
+    cache_ptr->index_split--;
+    cache_ptr->index_nbuckets--;
+
+    old_bucket = cache_ptr->index_split;
+    new_bucket = cache_ptr->index_nbuckets;
+    HDassert(new_bucket == old_bucket + cache_ptr->index_mask + 1);
+
+    /* Append the entries of the new bucket to the old one */
+    if(NULL != (entry_ptr = cache_ptr->index[new_bucket])) {
+        H5C_cache_entry_t *tail_ptr = cache_ptr->index[old_bucket];
+
+        if(tail_ptr) {
+            while(tail_ptr->ht_next)
+                tail_ptr = tail_ptr->ht_next;
+            tail_ptr->ht_next = entry_ptr;
+        } /* end if */
+        else
+            cache_ptr->index[old_bucket] = entry_ptr;
+        entry_ptr->ht_prev = tail_ptr;
+        cache_ptr->index[new_bucket] = NULL;
+    } /* end if */
+
+    /* Give back the memory for the buckets of the higher levels once a
+     * level is emptied.  (Failing to shrink the array isn't an error, the
+     * larger array is kept)
+     */
+    if(cache_ptr->index_split == 0 && cache_ptr->index_alloc >= 4 * cache_ptr->index_nbuckets) {
+        H5C_cache_entry_t **new_index;
+        uint32_t new_alloc = 2 * cache_ptr->index_nbuckets;
+
+        if(NULL != (new_index = (H5C_cache_entry_t **)H5MM_realloc(cache_ptr->index, new_alloc * sizeof(H5C_cache_entry_t *)))) {
+            cache_ptr->index = new_index;
+            cache_ptr->index_alloc = new_alloc;
+        } /* end if */
+    } /* end if */
+
+    H5C__UPDATE_STATS_FOR_HT_MERGE(cache_ptr)
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* H5C__index_merge() */
+
 
 /*-------------------------------------------------------------------------
  *
@@ -110,7 +110,7 @@ H5C_dump_cache(H5C_t * cache_ptr, const char *  cache_name)
      * Do this, as we want to display cache entries in increasing address
      * order.
      */
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->index_nbuckets; i++) {
         entry_ptr = cache_ptr->index[i];
 
         while(entry_ptr != NULL) {
@@ -567,6 +567,8 @@ H5C_stats(H5C_t * cache_ptr,
     double      prefetch_use_rate;
     double	average_successful_search_depth = 0.0f;
     double	average_failed_search_depth = 0.0f;
+    int64_t     chain_len_hist[H5C__HT_HIST_LEN];
+    uint32_t    max_chain_len = 0;
     double      average_entries_skipped_per_calls_to_msic = 0.0f;
     double      average_dirty_pf_entries_skipped_per_call_to_msic = 0.0f;
     double      average_entries_scanned_per_calls_to_msic = 0.0f;
@@ -646,6 +648,19 @@ H5C_stats(H5C_t * cache_ptr,
             ((double)(cache_ptr->total_failed_ht_search_depth)) /
             ((double)(cache_ptr->failed_ht_searches));
 
+    /* Count the hash buckets by the length of their chains */
+    HDmemset(chain_len_hist, 0, sizeof(chain_len_hist));
+    for(i = 0; i < (int)cache_ptr->index_nbuckets; i++) {
+        H5C_cache_entry_t *entry_ptr;
+        uint32_t chain_len = 0;
+
+        for(entry_ptr = cache_ptr->index[i]; entry_ptr; entry_ptr = entry_ptr->ht_next)
+            chain_len++;
+        chain_len_hist[H5C__HT_HIST_CELL(chain_len)]++;
+        if(chain_len > max_chain_len)
+            max_chain_len = chain_len;
+    } /* end for */
+
 
     HDfprintf(stdout, "\n%sH5C: cache statistics for %s\n",
               cache_ptr->prefix, cache_name);
@@ -678,6 +693,43 @@ H5C_stats(H5C_t * cache_ptr,
               (unsigned long)(cache_ptr->index_len),
               (unsigned long)(cache_ptr->max_index_len));
 
+    HDfprintf(stdout,
+             "%s  current (max) HT buckets           = %lu (%lu)\n",
+              cache_ptr->prefix,
+              (unsigned long)(cache_ptr->index_nbuckets),
+              (unsigned long)(cache_ptr->max_index_nbuckets));
+
+    HDfprintf(stdout,
+              "%s  HT bucket splits / merges          = %ld / %ld\n",
+              cache_ptr->prefix,
+              (long)(cache_ptr->index_splits),
+              (long)(cache_ptr->index_merges));
+
+    HDfprintf(stdout,
+              "%s  HT chain lengths                   = 0 / 1 / 2 / 3 / 4-7 / 8-15 / 16-31 / 32+ (max %lu)\n",
+              cache_ptr->prefix,
+              (unsigned long)max_chain_len);
+
+    HDfprintf(stdout,
+              "%s    buckets                          = %ld / %ld / %ld / %ld / %ld / %ld / %ld / %ld\n",
+              cache_ptr->prefix,
+              (long)chain_len_hist[0], (long)chain_len_hist[1],
+              (long)chain_len_hist[2], (long)chain_len_hist[3],
+              (long)chain_len_hist[4], (long)chain_len_hist[5],
+              (long)chain_len_hist[6], (long)chain_len_hist[7]);
+
+    HDfprintf(stdout,
+              "%s    failed searches                  = %ld / %ld / %ld / %ld / %ld / %ld / %ld / %ld\n",
+              cache_ptr->prefix,
+              (long)(cache_ptr->failed_ht_search_depth_hist[0]),
+              (long)(cache_ptr->failed_ht_search_depth_hist[1]),
+              (long)(cache_ptr->failed_ht_search_depth_hist[2]),
+              (long)(cache_ptr->failed_ht_search_depth_hist[3]),
+              (long)(cache_ptr->failed_ht_search_depth_hist[4]),
+              (long)(cache_ptr->failed_ht_search_depth_hist[5]),
+              (long)(cache_ptr->failed_ht_search_depth_hist[6]),
+              (long)(cache_ptr->failed_ht_search_depth_hist[7]));
+
     HDfprintf(stdout,
              "%s  current (max) clean/dirty idx size = %ld (%ld) / %ld (%ld)\n",
               cache_ptr->prefix,
@@ -1070,6 +1122,11 @@ H5C_stats__reset(H5C_t H5_ATTR_UNUSED * cache_ptr)
     cache_ptr->total_successful_ht_search_depth	= 0;
     cache_ptr->failed_ht_searches		= 0;
     cache_ptr->total_failed_ht_search_depth	= 0;
+    for(i = 0; i < H5C__HT_HIST_LEN; i++)
+        cache_ptr->failed_ht_search_depth_hist[i] = 0;
+    cache_ptr->index_splits			= 0;
+    cache_ptr->index_merges			= 0;
+    cache_ptr->max_index_nbuckets		= cache_ptr->index_nbuckets;
 
     cache_ptr->max_index_len			= 0;
     cache_ptr->max_index_size			= (size_t)0;
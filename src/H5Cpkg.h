@@ -47,9 +47,17 @@
 #define H5C__MAX_EPOCH_MARKERS                  10
 
 /* Cache configuration settings */
-#define H5C__HASH_TABLE_LEN     (64 * 1024) /* must be a power of 2 */
+#define H5C__HASH_TABLE_LEN     (64 * 1024) /* initial & minimum number of */
+                                            /* buckets, must be a power of 2 */
 #define H5C__H5C_T_MAGIC	0x005CAC0E
 
+/* Number of cells in the hash bucket chain length histograms, and the
+ * cell counting chains of length n: 0, 1, 2, 3, 4-7, 8-15, 16-31 and 32+
+ */
+#define H5C__HT_HIST_LEN        8
+#define H5C__HT_HIST_CELL(n)    ((n) < 4 ? (int)(n) : (n) < 8 ? 4 : \
+                                 (n) < 16 ? 5 : (n) < 32 ? 6 : 7)
+
 /* Initial allocated size of the "flush_dep_parent" array */
 #define H5C_FLUSH_DEP_PARENT_INIT 8
 
@@ -665,8 +673,20 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
 	} else {                                                    \
 	    (cache_ptr)->failed_ht_searches++;                      \
 	    (cache_ptr)->total_failed_ht_search_depth += depth;     \
+	    ((cache_ptr)->failed_ht_search_depth_hist)              \
+	            [H5C__HT_HIST_CELL(depth)]++;                   \
 	}
 
+#define H5C__UPDATE_STATS_FOR_HT_SPLIT(cache_ptr)                   \
+	(cache_ptr)->index_splits++;                                \
+	if ( (cache_ptr)->index_nbuckets >                          \
+	        (cache_ptr)->max_index_nbuckets )                   \
+	    (cache_ptr)->max_index_nbuckets =                       \
+	            (cache_ptr)->index_nbuckets;
+
+#define H5C__UPDATE_STATS_FOR_HT_MERGE(cache_ptr) \
+	(cache_ptr)->index_merges++;
+
 #define H5C__UPDATE_STATS_FOR_UNPIN(cache_ptr, entry_ptr) \
 	((cache_ptr)->unpins)[(entry_ptr)->type->id]++;
 
@@ -925,6 +945,8 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
 #define H5C__UPDATE_STATS_FOR_HT_INSERTION(cache_ptr)
 #define H5C__UPDATE_STATS_FOR_HT_DELETION(cache_ptr)
 #define H5C__UPDATE_STATS_FOR_HT_SEARCH(cache_ptr, success, depth)
+#define H5C__UPDATE_STATS_FOR_HT_SPLIT(cache_ptr)
+#define H5C__UPDATE_STATS_FOR_HT_MERGE(cache_ptr)
 #define H5C__UPDATE_STATS_FOR_INSERTION(cache_ptr, entry_ptr)
 #define H5C__UPDATE_STATS_FOR_CLEAR(cache_ptr, entry_ptr)
 #define H5C__UPDATE_STATS_FOR_FLUSH(cache_ptr, entry_ptr)
@@ -978,11 +1000,19 @@ if ( ( ( ( (head_ptr) == NULL ) || ( (tail_ptr) == NULL ) ) &&             \
  *
  ***********************************************************************/
 
-/* H5C__HASH_TABLE_LEN is defined in H5Cpkg.h.  It mut be a power of two. */
+/* The index is a linear hash table (see the index_nbuckets field of
+ * H5C_t).  Buckets below index_split have already been split at the
+ * current level, so their entries are hashed with one more bit of the
+ * address.
+ */
 
-#define H5C__HASH_MASK		((size_t)(H5C__HASH_TABLE_LEN - 1) << 3)
+#define H5C__HASH_KEY(x)	((size_t)((x) >> 3))
 
-#define H5C__HASH_FCN(x)	(int)((unsigned)((x) & H5C__HASH_MASK) >> 3)
+#define H5C__HASH_FCN(cache_ptr, x)                                         \
+    (int)(((H5C__HASH_KEY(x) & (cache_ptr)->index_mask) <                   \
+           (size_t)(cache_ptr)->index_split) ?                              \
+          (H5C__HASH_KEY(x) & (((cache_ptr)->index_mask << 1) | 1)) :       \
+          (H5C__HASH_KEY(x) & (cache_ptr)->index_mask))
 
 #if H5C_DO_SANITY_CHECKS
 
@@ -994,8 +1024,9 @@ if ( ( (cache_ptr) == NULL ) ||                                         \
      ( (entry_ptr)->ht_next != NULL ) ||                                \
      ( (entry_ptr)->ht_prev != NULL ) ||                                \
      ( (entry_ptr)->size <= 0 ) ||                                      \
-     ( H5C__HASH_FCN((entry_ptr)->addr) < 0 ) ||                        \
-     ( H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ) ||     \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) < 0 ) ||             \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) >=                   \
+       (int)(cache_ptr)->index_nbuckets ) ||                            \
      ( (cache_ptr)->index_size !=                                       \
        ((cache_ptr)->clean_index_size +                                 \
 	(cache_ptr)->dirty_index_size) ) ||                             \
@@ -1046,14 +1077,18 @@ if ( ( (cache_ptr) == NULL ) ||                                         \
      ( (cache_ptr)->index_size < (entry_ptr)->size ) ||                 \
      ( ! H5F_addr_defined((entry_ptr)->addr) ) ||                       \
      ( (entry_ptr)->size <= 0 ) ||                                      \
-     ( H5C__HASH_FCN((entry_ptr)->addr) < 0 ) ||                        \
-     ( H5C__HASH_FCN((entry_ptr)->addr) >= H5C__HASH_TABLE_LEN ) ||     \
-     ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))]         \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) < 0 ) ||             \
+     ( H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr) >=                   \
+       (int)(cache_ptr)->index_nbuckets ) ||                            \
+     ( ((cache_ptr)->index)[H5C__HASH_FCN(cache_ptr,                    \
+                                          (entry_ptr)->addr)]           \
        == NULL ) ||                                                     \
-     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))]       \
+     ( ( ((cache_ptr)->index)[H5C__HASH_FCN(cache_ptr,                  \
+                                            (entry_ptr)->addr)]         \
        != (entry_ptr) ) &&                                              \
        ( (entry_ptr)->ht_prev == NULL ) ) ||                            \
-     ( ( ((cache_ptr)->index)[(H5C__HASH_FCN((entry_ptr)->addr))] ==    \
+     ( ( ((cache_ptr)->index)[H5C__HASH_FCN(cache_ptr,                  \
+                                            (entry_ptr)->addr)] ==      \
          (entry_ptr) ) &&                                               \
        ( (entry_ptr)->ht_prev != NULL ) ) ||                            \
      ( (cache_ptr)->index_size !=                                       \
@@ -1112,8 +1147,8 @@ if ( ( (cache_ptr) == NULL ) ||                                             \
      ( (cache_ptr)->index_size !=                                           \
        ((cache_ptr)->clean_index_size + (cache_ptr)->dirty_index_size) ) || \
      ( ! H5F_addr_defined(Addr) ) ||                                        \
-     ( H5C__HASH_FCN(Addr) < 0 ) ||                                         \
-     ( H5C__HASH_FCN(Addr) >= H5C__HASH_TABLE_LEN ) ) {                     \
+     ( H5C__HASH_FCN(cache_ptr, Addr) < 0 ) ||                              \
+     ( H5C__HASH_FCN(cache_ptr, Addr) >= (int)(cache_ptr)->index_nbuckets ) ) { \
     HGOTO_ERROR(H5E_CACHE, H5E_SYSTEM, fail_val, "pre HT search SC failed") \
 }
 
@@ -1323,7 +1358,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
 {                                                                            \
     int k;                                                                   \
     H5C__PRE_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                    \
-    k = H5C__HASH_FCN((entry_ptr)->addr);                                    \
+    k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                         \
     if(((cache_ptr)->index)[k] != NULL) {                                    \
         (entry_ptr)->ht_next = ((cache_ptr)->index)[k];                      \
         (entry_ptr)->ht_next->ht_prev = (entry_ptr);                         \
@@ -1351,6 +1386,9 @@ if ( ( (cache_ptr)->index_size !=                                           \
                        (cache_ptr)->il_tail, (cache_ptr)->il_len,            \
                        (cache_ptr)->il_size, fail_val)                       \
     H5C__UPDATE_STATS_FOR_HT_INSERTION(cache_ptr)                            \
+    if((cache_ptr)->index_len > (cache_ptr)->index_nbuckets)                 \
+        if(H5C__index_split(cache_ptr) < 0)                                  \
+            HGOTO_ERROR(H5E_CACHE, H5E_CANTALLOC, fail_val, "can't grow cache index") \
     H5C__POST_HT_INSERT_SC(cache_ptr, entry_ptr, fail_val)                   \
 }
 
@@ -1358,7 +1396,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
 {                                                                            \
     int k;                                                                   \
     H5C__PRE_HT_REMOVE_SC(cache_ptr, entry_ptr)                              \
-    k = H5C__HASH_FCN((entry_ptr)->addr);                                    \
+    k = H5C__HASH_FCN(cache_ptr, (entry_ptr)->addr);                         \
     if((entry_ptr)->ht_next)                                                 \
         (entry_ptr)->ht_next->ht_prev = (entry_ptr)->ht_prev;                \
     if((entry_ptr)->ht_prev)                                                 \
@@ -1389,6 +1427,9 @@ if ( ( (cache_ptr)->index_size !=                                           \
                        (cache_ptr)->il_tail, (cache_ptr)->il_len,            \
                        (cache_ptr)->il_size, fail_val)                       \
     H5C__UPDATE_STATS_FOR_HT_DELETION(cache_ptr)                             \
+    if(((cache_ptr)->index_nbuckets > H5C__HASH_TABLE_LEN) &&                \
+            ((cache_ptr)->index_len < (cache_ptr)->index_nbuckets / 4))      \
+        H5C__index_merge(cache_ptr);                                         \
     H5C__POST_HT_REMOVE_SC(cache_ptr, entry_ptr)                             \
 }
 
@@ -1397,7 +1438,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
     int k;                                                                  \
     int depth = 0;                                                          \
     H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)                        \
-    k = H5C__HASH_FCN(Addr);                                                \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                     \
     entry_ptr = ((cache_ptr)->index)[k];                                    \
     while(entry_ptr) {                                                      \
         if(H5F_addr_eq(Addr, (entry_ptr)->addr)) {                          \
@@ -1425,7 +1466,7 @@ if ( ( (cache_ptr)->index_size !=                                           \
 {                                                                           \
     int k;                                                                  \
     H5C__PRE_HT_SEARCH_SC(cache_ptr, Addr, fail_val)                        \
-    k = H5C__HASH_FCN(Addr);                                                \
+    k = H5C__HASH_FCN(cache_ptr, Addr);                                     \
     entry_ptr = ((cache_ptr)->index)[k];                                    \
     while(entry_ptr) {                                                      \
         if(H5F_addr_eq(Addr, (entry_ptr)->addr)) {                          \
@@ -3677,9 +3718,9 @@ typedef struct H5C_tag_info_t {
  *		index by ring.  Note that the sum of all cells in this array 
  *		must equal the value stored in dirty_index_size above.
  *
- * index:	Array of pointer to H5C_cache_entry_t of size
- *		H5C__HASH_TABLE_LEN.  At present, this value is a power
- *		of two, not the usual prime number.
+ * index:	Dynamically allocated array of pointer to H5C_cache_entry_t,
+ *		with index_alloc cells, of which the first index_nbuckets
+ *		are the heads of the hash buckets.
  *
  *		I hope that the variable size of cache elements, the large
  *		hash table size, and the way in which HDF5 allocates space
@@ -3687,10 +3728,36 @@ typedef struct H5C_tag_info_t {
  *		can use a trivial hash function (a bit-and and a 3 bit left
  *		shift) with some small savings.
  *
- *		If not, it will become evident in the statistics. Changing
- *		to the usual prime number length hash table will require
- *		changing the H5C__HASH_FCN macro and the deletion of the
- *		H5C__HASH_MASK #define.  No other changes should be required.
+ *		If not, it will become evident in the statistics (see the
+ *		hash bucket histogram printed by H5C_stats()).
+ *
+ * index_nbuckets: Number of hash buckets currently in use.
+ *
+ *		The index is a linear hash table, so that lookups stay
+ *		cheap in caches holding millions of entries.  It starts
+ *		with H5C__HASH_TABLE_LEN buckets.  Whenever an insertion
+ *		leaves more entries than buckets in the index, the bucket
+ *		at index_split is split in two with H5C__index_split(),
+ *		and whenever a deletion leaves fewer entries than a quarter
+ *		of the buckets, the last bucket is merged back into its
+ *		buddy with H5C__index_merge(), until the index is back to
+ *		H5C__HASH_TABLE_LEN buckets.  Each split or merge touches
+ *		only one bucket, so the cost of resizing is spread across
+ *		the insertions and deletions.
+ *
+ * index_mask:	Mask applied to the address (shifted right 3 bits) to
+ *		get the bucket of an entry at the current level of the
+ *		linear hash table.  index_mask + 1 is a power of two, and
+ *		is the number of buckets at the start of the level.
+ *
+ * index_split: Next bucket to be split.  Buckets below index_split have
+ *		been split at the current level, and are found with one
+ *		more bit of the address (see H5C__HASH_FCN).  We always
+ *		have index_nbuckets == index_mask + 1 + index_split.
+ *
+ * index_alloc: Number of cells allocated in the index array.  This is
+ *		at least index_nbuckets, and is doubled when a new level
+ *		is started.
  *
  * il_len:	Number of entries on the index list.  
  *
@@ -4488,6 +4555,19 @@ typedef struct H5C_tag_info_t {
  *              entries examined in unsuccessful searches of the hash
  *		table in the current epoch.
  *
+ * failed_ht_search_depth_hist: Array of int64 of length H5C__HT_HIST_LEN,
+ *		counting the unsuccessful searches of the hash table in the
+ *		current epoch by the length of the hash bucket chain
+ *		examined (see H5C__HT_HIST_CELL for the chain lengths
+ *		counted in each cell).
+ *
+ * index_splits: Number of hash buckets split in the current epoch.
+ *
+ * index_merges: Number of hash buckets merged in the current epoch.
+ *
+ * max_index_nbuckets: Largest value attained by the index_nbuckets field
+ *		in the current epoch.
+ *
  * max_index_len:  Largest value attained by the index_len field in the
  *              current epoch.
  *
@@ -4700,7 +4780,11 @@ struct H5C_t {
     size_t			clean_index_ring_size[H5C_RING_NTYPES];
     size_t			dirty_index_size;
     size_t			dirty_index_ring_size[H5C_RING_NTYPES];
-    H5C_cache_entry_t *	        index[H5C__HASH_TABLE_LEN];
+    H5C_cache_entry_t **        index;
+    uint32_t                    index_nbuckets;
+    size_t                      index_mask;
+    uint32_t                    index_split;
+    uint32_t                    index_alloc;
     uint32_t                    il_len;
     size_t                      il_size;
     H5C_cache_entry_t *	        il_head;
@@ -4850,6 +4934,10 @@ struct H5C_t {
     int64_t			total_successful_ht_search_depth;
     int64_t			failed_ht_searches;
     int64_t			total_failed_ht_search_depth;
+    int64_t			failed_ht_search_depth_hist[H5C__HT_HIST_LEN];
+    int64_t			index_splits;
+    int64_t			index_merges;
+    uint32_t                    max_index_nbuckets;
     uint32_t                    max_index_len;
     size_t                      max_index_size;
     size_t                      max_clean_index_size;
@@ -4932,6 +5020,8 @@ H5_DLL herr_t H5C__deserialize_prefetched_entry(H5F_t *f, hid_t dxpl_id,
 H5_DLL herr_t H5C__flush_single_entry(H5F_t *f, hid_t dxpl_id,
     H5C_cache_entry_t *entry_ptr, unsigned flags);
 H5_DLL herr_t H5C__generate_cache_image(H5F_t *f, hid_t dxpl_id, H5C_t *cache_ptr);
+H5_DLL herr_t H5C__index_split(H5C_t *cache_ptr);
+H5_DLL void H5C__index_merge(H5C_t *cache_ptr);
 H5_DLL herr_t H5C__load_cache_image(H5F_t *f, hid_t dxpl_id);
 H5_DLL herr_t H5C__mark_flush_dep_serialized(H5C_cache_entry_t * entry_ptr);
 H5_DLL herr_t H5C__mark_flush_dep_unserialized(H5C_cache_entry_t * entry_ptr);
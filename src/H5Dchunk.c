@@ -26,16 +26,17 @@
  *		contains code to optionally align chunks on disk block
  *		boundaries for performance.
  *
- *		The chunk cache is an extendible hash indexed by a function
- *		of storage B-tree address and chunk N-dimensional offset
- *		within the dataset.  Collisions are not resolved -- one of
- *		the two chunks competing for the hash slot must be preempted
- *		from the cache.  All entries in the hash also participate in
- *		a doubly-linked list and entries are penalized by moving them
- *		toward the front of the list.  When a new chunk is about to
- *		be added to the cache the heap is pruned by preempting
- *		entries near the front of the list to make room for the new
- *		entry which is added to the end of the list.
+ *		The chunk cache is an open addressing hash table, with
+ *		linear probing, indexed by a function of the chunk's scaled
+ *		N-dimensional offset within the dataset.  The table grows
+ *		with the number of cached chunks, so chunks only compete for
+ *		the cache's bytes, not for hash slots.  All entries in the
+ *		hash also participate in a doubly-linked list and entries
+ *		are penalized by moving them toward the front of the list.
+ *		When a new chunk is about to be added to the cache the heap
+ *		is pruned by preempting entries near the front of the list
+ *		to make room for the new entry which is added to the end of
+ *		the list.
  */
 
 /****************/
@@ -67,9 +68,15 @@
 /****************/
 
 /* Macros for iterating over chunks to operate on */
-#define H5D_CHUNK_GET_FIRST_NODE(map) (map->use_single ? (H5SL_node_t *)(1) : H5SL_first(map->sel_chunks))
-#define H5D_CHUNK_GET_NODE_INFO(map, node)  (map->use_single ? map->single_chunk_info : (H5D_chunk_info_t *)H5SL_item(node))
-#define H5D_CHUNK_GET_NEXT_NODE(map, node)  (map->use_single ? (H5SL_node_t *)NULL : H5SL_next(node))
+/* (With a regular map, the "node" is the position of the chunk among the
+ *      chunks selected, plus one.  Getting its info can fail.)
+ */
+#define H5D_CHUNK_GET_FIRST_NODE(map) ((map->use_single || map->use_regular) ? (H5SL_node_t *)(1) : H5SL_first(map->sel_chunks))
+#define H5D_CHUNK_GET_NODE_INFO(map, node)  (map->use_single ? map->single_chunk_info : \
+        (map->use_regular ? H5D__chunk_map_regular_info(map, node) : (H5D_chunk_info_t *)H5SL_item(node)))
+#define H5D_CHUNK_GET_NEXT_NODE(map, node)  (map->use_single ? (H5SL_node_t *)NULL : \
+        (map->use_regular ? ((hsize_t)(size_t)(node) < map->reg_nchunks ? (H5SL_node_t *)((size_t)(node) + 1) : (H5SL_node_t *)NULL) : \
+        H5SL_next(node)))
 
 /* Sanity check on chunk index types: commonly used by a lot of routines in this file */
 #define H5D_CHUNK_STORAGE_INDEX_CHK(storage)                                                    \
@@ -80,6 +87,41 @@
              (H5D_CHUNK_IDX_SINGLE == storage->idx_type && H5D_COPS_SINGLE == storage->ops) ||  \
              (H5D_CHUNK_IDX_NONE == storage->idx_type && H5D_COPS_NONE == storage->ops));
 
+/* Macros for maintaining the LRU list of the file-wide shared chunk cache */
+#define H5D_RDCC_SHARED_UNLINK(sc, ent)                                         \
+{                                                                               \
+    if((ent)->sh_prev)                                                          \
+        (ent)->sh_prev->sh_next = (ent)->sh_next;                               \
+    else                                                                        \
+        (sc)->head = (ent)->sh_next;                                            \
+    if((ent)->sh_next)                                                          \
+        (ent)->sh_next->sh_prev = (ent)->sh_prev;                               \
+    else                                                                        \
+        (sc)->tail = (ent)->sh_prev;                                            \
+    (ent)->sh_prev = (ent)->sh_next = NULL;                                     \
+}
+#define H5D_RDCC_SHARED_APPEND(sc, ent)                                         \
+{                                                                               \
+    (ent)->sh_next = NULL;                                                      \
+    (ent)->sh_prev = (sc)->tail;                                                \
+    if((sc)->tail)                                                              \
+        (sc)->tail->sh_next = (ent);                                            \
+    else                                                                        \
+        (sc)->head = (ent);                                                     \
+    (sc)->tail = (ent);                                                         \
+}
+
+/* Minimum number of slots in the chunk cache hash table (a power of two) */
+#define H5D_RDCC_SLOTS_MIN      16
+
+/* Initial number of entries in the chunk address cache (a power of two) */
+#define H5D_CINFO_NALLOC_MIN    64
+
+/* Marker for hash table slots whose entry was removed.  Lookups must probe
+ * past these, insertions can reuse them.
+ */
+#define H5D_RDCC_SLOT_DELETED   (&H5D_rdcc_slot_deleted_g)
+
 /*
  * Feature: If this constant is defined then every cache preemption and load
  *	    causes a character to be printed on the standard error stream:
@@ -91,10 +133,6 @@
  *
  *     `:': Entry was preempted because it hasn't been used recently.
  *
- *     `#': Entry was preempted because another chunk collided with it. This
- *	    is usually a relatively bad thing.  If there are too many of
- *	    these then the number of entries in the cache can be increased.
- *
  *       c: Entry was preempted because the file is closing.
  *
  *	 w: A chunk read operation was eliminated because the library is
@@ -121,6 +159,8 @@ typedef struct H5D_rdcc_ent_t {
     hbool_t	locked;		/*entry is locked in cache		*/
     hbool_t	dirty;		/*needs to be written to disk?		*/
     hbool_t     deleted;        /*chunk about to be deleted		*/
+    hbool_t     hot;            /*entry is on the protected queue (2Q)	*/
+    hbool_t     prefetched;     /*entry was read ahead, not accessed yet */
     unsigned    edge_chunk_state; /*states related to edge chunks (see above) */
     hsize_t 	scaled[H5O_LAYOUT_NDIMS]; /*scaled chunk 'name' (coordinates) */
     uint32_t	rd_count;	/*bytes remaining to be read		*/
@@ -131,11 +171,32 @@ typedef struct H5D_rdcc_ent_t {
     unsigned	idx;		/*index in hash table			*/
     struct H5D_rdcc_ent_t *next;/*next item in doubly-linked list	*/
     struct H5D_rdcc_ent_t *prev;/*previous item in doubly-linked list	*/
-    struct H5D_rdcc_ent_t *tmp_next;/*next item in temporary doubly-linked list */
-    struct H5D_rdcc_ent_t *tmp_prev;/*previous item in temporary doubly-linked list */
+    H5D_shared_t *dset_shared;  /*dataset that owns the entry (for the file-wide cache) */
+    struct H5D_rdcc_ent_t *sh_next;/*next item in file-wide shared cache list */
+    struct H5D_rdcc_ent_t *sh_prev;/*previous item in file-wide shared cache list */
 } H5D_rdcc_ent_t;
 typedef H5D_rdcc_ent_t *H5D_rdcc_ent_ptr_t; /* For free lists */
 
+/* Information for running the I/O filter pipeline on several chunks at once */
+typedef struct H5D_chunk_filter_op_t {
+    const H5O_pline_t   *pline;         /* I/O pipeline to apply */
+    unsigned            flags;          /* Pipeline direction (H5Z_FLAG_REVERSE or 0) */
+    H5Z_EDC_t           err_detect;     /* Error detection info */
+    H5Z_cb_t            filter_cb;      /* Filter callback function */
+    H5D_chunk_filt_t    *bufs;          /* Chunk buffers to filter */
+    size_t              nbufs;          /* Number of chunk buffers */
+    size_t              nworkers;       /* Number of workers sharing the buffers */
+} H5D_chunk_filter_op_t;
+
+/* Work assignment for one filter pipeline worker */
+typedef struct H5D_chunk_filter_worker_t {
+    const H5D_chunk_filter_op_t *op;    /* Operation the worker is part of */
+    size_t              first;          /* First buffer for this worker, it then
+                                         * takes every 'nworkers'th buffer */
+    hbool_t             own_thread;     /* Whether the worker runs on a thread
+                                         * of its own */
+} H5D_chunk_filter_worker_t;
+
 /* Callback info for iteration to prune chunks */
 typedef struct H5D_chunk_it_ud1_t {
     H5D_chunk_common_ud_t common;       /* Common info for B-tree user data (must be first) */
@@ -209,6 +270,36 @@ typedef struct H5D_chunk_it_ud5_t {
     hsize_t       	*dset_dims;             /* Dataset dimensions */
 } H5D_chunk_it_ud5_t;
 
+/* A chunk requested from H5D__chunk_direct_read_multi() */
+typedef struct H5D_chunk_direct_rd_t {
+    hsize_t             scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of chunk */
+    hsize_t             chunk_idx;              /* Linear index of chunk in dataset */
+    haddr_t             addr;                   /* Address of chunk in file */
+    hsize_t             nbytes;                 /* Size of stored chunk */
+    uint32_t            filter_mask;            /* Excluded filters */
+    size_t              req;                    /* Position of request in caller's arrays */
+} H5D_chunk_direct_rd_t;
+
+/* A chunk written by H5D__chunk_direct_write_multi() */
+typedef struct H5D_chunk_direct_wr_t {
+    hsize_t             scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of chunk */
+    hsize_t             chunk_idx;              /* Linear index of chunk in dataset */
+    H5D_chunk_ud_t      udata;                  /* Index information for chunk */
+    H5F_block_t         old_chunk;              /* Offset/length of old chunk */
+    hbool_t             need_insert;            /* Whether the chunk needs to be inserted into the index */
+    hbool_t             inserted;               /* Whether the chunk was inserted into the index */
+    uint32_t            filter_mask;            /* Excluded filters */
+    uint32_t            nbytes;                 /* Size of chunk */
+    const void          *buf;                   /* Chunk data */
+} H5D_chunk_direct_wr_t;
+
+/* Callback info for iteration to find the chunks of a multi-chunk direct read */
+typedef struct H5D_chunk_it_ud6_t {
+    H5D_chunk_common_ud_t common;               /* Common info for B-tree user data (must be first) */
+    H5D_chunk_direct_rd_t *rds;                 /* Requests, sorted by chunk index */
+    size_t              nrds;                   /* Number of requests */
+} H5D_chunk_it_ud6_t;
+
 /* Callback info for nonexistent readvv operation */
 typedef struct H5D_chunk_readvv_ud_t {
     unsigned char *rbuf;        /* Read buffer to initialize */
@@ -269,14 +360,21 @@ static void *H5D__chunk_mem_alloc(size_t size, const H5O_pline_t *pline);
 static void *H5D__chunk_mem_xfree(void *chk, const H5O_pline_t *pline);
 static void *H5D__chunk_mem_realloc(void *chk, size_t size,
     const H5O_pline_t *pline);
-static herr_t H5D__chunk_cinfo_cache_reset(H5D_chunk_cached_t *last);
-static herr_t H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last,
+static size_t H5D__chunk_cinfo_hash_val(const H5D_rdcc_t *rdcc, hsize_t key);
+static hsize_t H5D__chunk_cinfo_key(const H5O_layout_chunk_t *layout,
+    const hsize_t *scaled);
+static herr_t H5D__chunk_cinfo_cache_update(H5D_rdcc_t *rdcc,
     const H5D_chunk_ud_t *udata);
-static hbool_t H5D__chunk_cinfo_cache_found(const H5D_chunk_cached_t *last,
+static hbool_t H5D__chunk_cinfo_cache_found(H5D_rdcc_t *rdcc,
     H5D_chunk_ud_t *udata);
 static herr_t H5D__free_chunk_info(void *item, void *key, void *opdata);
 static herr_t H5D__create_chunk_map_single(H5D_chunk_map_t *fm,
     const H5D_io_info_t *io_info);
+static herr_t H5D__chunk_single_init(H5D_chunk_map_t *fm, const H5D_t *dataset,
+    const H5S_t *file_space);
+static htri_t H5D__create_chunk_map_regular(H5D_chunk_map_t *fm);
+static H5D_chunk_info_t *H5D__chunk_map_regular_info(const H5D_chunk_map_t *fm,
+    const H5SL_node_t *node);
 static herr_t H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm,
     const H5D_io_info_t *io_info);
 static herr_t H5D__create_chunk_mem_map_hyper(const H5D_chunk_map_t *fm);
@@ -284,9 +382,16 @@ static herr_t H5D__chunk_file_cb(void *elem, const H5T_t *type, unsigned ndims,
     const hsize_t *coords, void *fm);
 static herr_t H5D__chunk_mem_cb(void *elem, const H5T_t *type, unsigned ndims,
     const hsize_t *coords, void *fm);
-static unsigned H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled);
+static unsigned H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled,
+    unsigned nbits);
+static unsigned H5D__chunk_cache_find(const H5D_shared_t *shared, const hsize_t *scaled);
+static herr_t H5D__chunk_cache_rehash(H5D_shared_t *shared, size_t nalloc);
+static herr_t H5D__chunk_cache_insert(H5D_shared_t *shared, H5D_rdcc_ent_t *ent);
 static herr_t H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id,
-    const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t *ent, hbool_t reset);
+    const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t *ent, hbool_t reset,
+    H5D_chunk_filt_t *filt);
+static herr_t H5D__chunk_flush_batch(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t **ent_p, hbool_t evict);
 static herr_t H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id,
     const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t *ent, hbool_t flush);
 static hbool_t H5D__chunk_is_partial_edge_chunk(unsigned dset_ndims,
@@ -298,7 +403,42 @@ static herr_t H5D__chunk_unlock(const H5D_io_info_t *io_info,
     uint32_t naccessed);
 static herr_t H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
     const H5D_dxpl_cache_t *dxpl_cache, size_t size);
+static herr_t H5D__chunk_cache_prune_shared(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, size_t size);
+static herr_t H5D__chunk_cache_prune_2q(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, size_t size);
+static void H5D__chunk_cache_ghost_add(H5D_shared_t *shared, const hsize_t *scaled);
+static hbool_t H5D__chunk_cache_ghost_remove(H5D_shared_t *shared,
+    const hsize_t *scaled);
+static void H5D__chunk_cache_ghost_unlink(H5D_shared_t *shared, size_t idx);
+static void H5D__chunk_cache_ghost_rehash(H5D_shared_t *shared);
+static void *H5D__chunk_filter_worker(void *_worker);
+static herr_t H5D__chunk_filter_bufs(const H5O_pline_t *pline, unsigned flags,
+    unsigned nthreads, const H5D_dxpl_cache_t *dxpl_cache,
+    H5D_chunk_filt_t *bufs, size_t nbufs);
+static herr_t H5D__chunk_stage_reserve(H5D_rdcc_t *rdcc, size_t nchunks);
+static herr_t H5D__chunk_stage_one(const H5D_io_info_t *io_info,
+    const hsize_t *scaled);
+static herr_t H5D__chunk_stage_filtered(const H5D_io_info_t *io_info,
+    const H5D_chunk_map_t *fm, H5SL_node_t **ahead_node);
+static hbool_t H5D__chunk_stage_take(H5D_rdcc_t *rdcc, unsigned ndims,
+    const hsize_t *scaled, haddr_t addr, void **buf, size_t *nbytes,
+    unsigned *filter_mask);
+static void H5D__chunk_stage_discard(H5D_rdcc_t *rdcc, const H5O_pline_t *pline);
+static void H5D__chunk_prefetch_note(H5D_rdcc_t *rdcc, unsigned ndims,
+    const hsize_t *scaled);
+static hbool_t H5D__chunk_prefetch_coords(const H5D_t *dset, size_t n,
+    hsize_t *scaled);
+static herr_t H5D__chunk_prefetch(H5D_io_info_t *io_info);
 static herr_t H5D__chunk_prune_fill(H5D_chunk_it_ud1_t *udata, hbool_t new_unfilt_chunk);
+static herr_t H5D__chunk_file_alloc_real(const H5D_chk_idx_info_t *idx_info,
+    const H5F_block_t *old_chunk, H5F_block_t *new_chunk, hbool_t *need_insert,
+    hsize_t scaled[], H5F_block_t *reserve);
+static int H5D__chunk_direct_rd_cmp_idx(const void *_rd1, const void *_rd2);
+static int H5D__chunk_direct_rd_cmp_addr(const void *_rd1, const void *_rd2);
+static int H5D__chunk_direct_rd_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata);
+static int H5D__chunk_direct_wr_cmp_idx(const void *_wr1, const void *_wr2);
+static int H5D__chunk_direct_wr_cmp_addr(const void *_wr1, const void *_wr2);
 #ifdef H5_HAVE_PARALLEL
 static herr_t H5D__chunk_collective_fill(const H5D_t *dset, hid_t dxpl_id,
     H5D_chunk_coll_info_t *chunk_info, size_t chunk_size, const void *fill_buf);
@@ -360,6 +500,9 @@ H5FL_SEQ_DEFINE_STATIC(H5D_rdcc_ent_ptr_t);
 /* Declare a free list to manage H5D_rdcc_ent_t objects */
 H5FL_DEFINE_STATIC(H5D_rdcc_ent_t);
 
+/* Entry that deleted hash table slots point to */
+static H5D_rdcc_ent_t H5D_rdcc_slot_deleted_g;
+
 /* Declare a free list to manage the H5D_chunk_info_t struct */
 H5FL_DEFINE(H5D_chunk_info_t);
 
@@ -488,6 +631,9 @@ H5D__chunk_direct_write(const H5D_t *dset, hid_t dxpl_id, uint32_t filters,
 
         if((layout->storage.u.chunk.ops->insert)(&idx_info, &udata, NULL) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+
+        /* Cache the new chunk information */
+        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk, &udata);
     } /* end if */
 
 done:
@@ -498,6 +644,300 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
 } /* end H5D__chunk_direct_write() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_wr_cmp_idx
+ *
+ * Purpose:     Compares two chunk write requests by linear chunk index,
+ *              for qsort().
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_wr_cmp_idx(const void *_wr1, const void *_wr2)
+{
+    const H5D_chunk_direct_wr_t *wr1 = (const H5D_chunk_direct_wr_t *)_wr1;
+    const H5D_chunk_direct_wr_t *wr2 = (const H5D_chunk_direct_wr_t *)_wr2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(wr1->chunk_idx < wr2->chunk_idx ? -1 : (wr1->chunk_idx > wr2->chunk_idx ? 1 : 0))
+} /* end H5D__chunk_direct_wr_cmp_idx() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_wr_cmp_addr
+ *
+ * Purpose:     Compares two chunk write requests by file address, for
+ *              qsort().
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_wr_cmp_addr(const void *_wr1, const void *_wr2)
+{
+    const H5D_chunk_direct_wr_t *wr1 = (const H5D_chunk_direct_wr_t *)_wr1;
+    const H5D_chunk_direct_wr_t *wr2 = (const H5D_chunk_direct_wr_t *)_wr2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(H5F_addr_cmp(wr1->udata.chunk_block.offset, wr2->udata.chunk_block.offset))
+} /* end H5D__chunk_direct_wr_cmp_addr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_write_multi
+ *
+ * Purpose:     Internal routine to write several chunks directly into the
+ *              file.  OFFSETS holds the logical offsets of the NCHUNKS
+ *              chunks, 'ndims' values each, on chunk boundaries, and no
+ *              chunk may be written twice.  Chunk i has the filter mask
+ *              FILTERS[i], and its NBYTES[i] bytes are in BUFS[i].
+ *
+ *              Unlike a sequence of H5D__chunk_direct_write() calls, the
+ *              file space for all the chunks that need it is allocated at
+ *              once, the chunks are written in file address order with
+ *              chunks that are adjacent in the file written at once, up
+ *              to the file's sieve buffer size, and the chunks are
+ *              inserted into the index in chunk order, so that the
+ *              inserts walk the index's nodes in order.
+ *
+ *              The space of a chunk that is moved is only released once
+ *              the index points to its new location.  If the call fails,
+ *              the chunks that weren't inserted into the index yet keep
+ *              their old data and the space reserved for them is
+ *              released.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_direct_write_multi(const H5D_t *dset, hid_t dxpl_id, size_t nchunks,
+    const hsize_t *offsets, const uint32_t *filters, const hsize_t *nbytes,
+    const void **bufs)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);       /* Dataset layout */
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk);	/*raw data chunk cache */
+    H5D_chunk_direct_wr_t *wrs = NULL;  /* Chunk write requests */
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
+    H5D_io_info_t io_info;              /* to hold the dset and two dxpls (meta and raw data) */
+    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    hbool_t dxpl_cache_init = FALSE;    /* Whether the DXPL cache was filled */
+    H5F_block_t reserve;                /* File space reserved for new chunks */
+    unsigned ndims = dset->shared->ndims; /* Rank of dataset */
+    uint8_t *run_buf = NULL;            /* Buffer for writing adjacent chunks at once */
+    size_t run_buf_size;                /* Size of run_buf */
+    size_t u, v;                        /* Local index variables */
+    hbool_t md_dxpl_generated = FALSE;  /* bool to indicate whether we should free the md_dxpl_id at exit */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_PACKAGE_TAG(dxpl_id, dset->oloc.addr, FAIL)
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(offsets || nchunks == 0);
+
+    reserve.offset = HADDR_UNDEF;
+    reserve.length = 0;
+
+    if(nchunks == 0)
+        HGOTO_DONE(SUCCEED)
+
+    io_info.dset = dset;
+    io_info.raw_dxpl_id = dxpl_id;
+    io_info.md_dxpl_id = dxpl_id;
+
+    /* set the dxpl IO type for sanity checking at the FD layer */
+#ifdef H5_DEBUG_BUILD
+    if(H5D_set_io_info_dxpls(&io_info, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't set metadata and raw data dxpls")
+    md_dxpl_generated = TRUE;
+#endif /* H5_DEBUG_BUILD */
+
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if(!(*layout->ops->is_space_alloc)(&layout->storage))
+        if(H5D__alloc_storage(&io_info, H5D_ALLOC_WRITE, FALSE, NULL) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize storage")
+
+    /* Compose chunked index info struct */
+    idx_info.f = dset->oloc.file;
+    idx_info.dxpl_id = io_info.md_dxpl_id;
+    idx_info.pline = &(dset->shared->dcpl_cache.pline);
+    idx_info.layout = &(dset->shared->layout.u.chunk);
+    idx_info.storage = &(dset->shared->layout.storage.u.chunk);
+
+    /* Set up the requests, in chunk order */
+    if(NULL == (wrs = (H5D_chunk_direct_wr_t *)H5MM_malloc(nchunks * sizeof(H5D_chunk_direct_wr_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk write requests")
+    for(u = 0; u < nchunks; u++) {
+        H5VM_chunk_scaled(ndims, offsets + u * ndims, layout->u.chunk.dim, wrs[u].scaled);
+        wrs[u].scaled[ndims] = 0;
+        wrs[u].chunk_idx = H5VM_array_offset_pre(ndims, layout->u.chunk.down_chunks, wrs[u].scaled);
+        wrs[u].need_insert = FALSE;
+        wrs[u].inserted = FALSE;
+        wrs[u].filter_mask = filters[u];
+        H5_CHECKED_ASSIGN(wrs[u].nbytes, uint32_t, nbytes[u], hsize_t);
+        wrs[u].buf = bufs[u];
+    } /* end for */
+    HDqsort(wrs, nchunks, sizeof(H5D_chunk_direct_wr_t), H5D__chunk_direct_wr_cmp_idx);
+
+    /* Find the chunks, and add up the space the new ones need */
+    for(u = 0; u < nchunks; u++) {
+        H5D_chunk_direct_wr_t *wr = &wrs[u];
+
+        if(u > 0 && wr->chunk_idx == wrs[u - 1].chunk_idx)
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk written more than once")
+
+        /* Find out the file address of the chunk (if any) */
+        if(H5D__chunk_lookup(dset, io_info.md_dxpl_id, wr->scaled, &wr->udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Sanity check */
+        HDassert((H5F_addr_defined(wr->udata.chunk_block.offset) && wr->udata.chunk_block.length > 0) ||
+                (!H5F_addr_defined(wr->udata.chunk_block.offset) && wr->udata.chunk_block.length == 0));
+
+        /* Evict the (old) entry from the cache if present, but do not flush
+         * it to disk */
+        if(UINT_MAX != wr->udata.idx_hint) {
+            if(!dxpl_cache_init) {
+                if(H5D__get_dxpl_cache(io_info.raw_dxpl_id, &dxpl_cache) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+                dxpl_cache_init = TRUE;
+            } /* end if */
+            if(H5D__chunk_cache_evict(dset, io_info.md_dxpl_id, dxpl_cache, rdcc->slot[wr->udata.idx_hint], FALSE) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+            wr->udata.idx_hint = UINT_MAX;
+        } /* end if */
+
+        /* Set the file block information for the old chunk */
+        wr->old_chunk = wr->udata.chunk_block;
+
+        /* The chunk needs new space if it doesn't exist yet, or if it's
+         * filtered and its size changed (as in H5D__chunk_file_alloc_real)
+         */
+        if(H5D_CHUNK_IDX_NONE != layout->storage.u.chunk.idx_type
+                && (!H5F_addr_defined(wr->old_chunk.offset)
+                    || (idx_info.pline->nused > 0 && wr->old_chunk.length != wr->nbytes)))
+            reserve.length += wr->nbytes;
+    } /* end for */
+
+    /* Allocate the space for all the new chunks at once */
+    if(reserve.length > 0)
+        if(HADDR_UNDEF == (reserve.offset = H5MF_alloc(idx_info.f, H5FD_MEM_DRAW, idx_info.dxpl_id, reserve.length)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+
+    /* Place the chunks */
+    for(u = 0; u < nchunks; u++) {
+        H5D_chunk_direct_wr_t *wr = &wrs[u];
+
+        /* Set up the size of chunk for user data */
+        wr->udata.chunk_block.length = wr->nbytes;
+
+        /* If there are no filters and we are overwriting the chunk we can
+         * just set values, otherwise create the chunk if it doesn't exist,
+         * or reallocate the chunk if its size has changed.
+         */
+        if(!(0 == idx_info.pline->nused && H5F_addr_defined(wr->old_chunk.offset)))
+            if(H5D__chunk_file_alloc_real(&idx_info, &wr->old_chunk, &wr->udata.chunk_block, &wr->need_insert, wr->scaled, &reserve) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+
+        /* Make sure the address of the chunk is returned. */
+        if(!H5F_addr_defined(wr->udata.chunk_block.offset))
+            HGOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "chunk address isn't defined")
+    } /* end for */
+    HDassert(reserve.length == 0);
+
+    /* Write the chunks in file address order, adjacent chunks at once */
+    HDqsort(wrs, nchunks, sizeof(H5D_chunk_direct_wr_t), H5D__chunk_direct_wr_cmp_addr);
+    run_buf_size = H5F_SIEVE_BUF_SIZE(dset->oloc.file);
+    for(u = 0; u < nchunks; u = v) {
+        hsize_t run_nbytes = wrs[u].nbytes;     /* Bytes in run of adjacent chunks */
+
+        /* Find the end of the run */
+        for(v = u + 1; v < nchunks; v++)
+            if(!H5F_addr_eq(wrs[v - 1].udata.chunk_block.offset + wrs[v - 1].nbytes, wrs[v].udata.chunk_block.offset)
+                    || run_nbytes + wrs[v].nbytes > run_buf_size)
+                break;
+            else
+                run_nbytes += wrs[v].nbytes;
+
+        if(v == u + 1) {
+            if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, wrs[u].udata.chunk_block.offset, (size_t)wrs[u].nbytes, io_info.raw_dxpl_id, wrs[u].buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+        } /* end if */
+        else {
+            size_t w;                   /* Local index variable */
+            size_t buf_off = 0;         /* Offset of chunk in run buffer */
+
+            if(NULL == run_buf && NULL == (run_buf = H5FL_BLK_MALLOC(chunk, run_buf_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunks")
+            for(w = u; w < v; w++) {
+                HDmemcpy(run_buf + buf_off, wrs[w].buf, (size_t)wrs[w].nbytes);
+                buf_off += (size_t)wrs[w].nbytes;
+            } /* end for */
+            if(H5F_block_write(dset->oloc.file, H5FD_MEM_DRAW, wrs[u].udata.chunk_block.offset, (size_t)run_nbytes, io_info.raw_dxpl_id, run_buf) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "unable to write raw data to file")
+        } /* end else */
+    } /* end for */
+
+    /* Insert the chunk records into the index, in chunk order */
+    if(layout->storage.u.chunk.ops->insert) {
+        HDqsort(wrs, nchunks, sizeof(H5D_chunk_direct_wr_t), H5D__chunk_direct_wr_cmp_idx);
+        for(u = 0; u < nchunks; u++)
+            if(wrs[u].need_insert) {
+                /* The request moved while sorting */
+                wrs[u].udata.common.scaled = wrs[u].scaled;
+
+                /* Set the chunk's filter mask to the new settings */
+                wrs[u].udata.filter_mask = wrs[u].filter_mask;
+
+                if((layout->storage.u.chunk.ops->insert)(&idx_info, &wrs[u].udata, NULL) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
+                wrs[u].inserted = TRUE;
+
+                /* Cache the new chunk information */
+                H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk, &wrs[u].udata);
+
+                /* Release the old chunk, now that the index no longer points
+                 * to it.  Only free the old location if not doing SWMR
+                 * writes - otherwise we must keep the old chunk around in
+                 * case a reader has an outdated version of the index.
+                 */
+                if(H5F_addr_defined(wrs[u].old_chunk.offset) && !(H5F_INTENT(idx_info.f) & H5F_ACC_SWMR_WRITE))
+                    if(H5MF_xfree(idx_info.f, H5FD_MEM_DRAW, idx_info.dxpl_id, wrs[u].old_chunk.offset, wrs[u].old_chunk.length) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
+            } /* end if */
+    } /* end if */
+
+done:
+    /* Release the space placed for chunks that didn't make it into the index */
+    if(ret_value < 0 && wrs)
+        for(u = 0; u < nchunks; u++)
+            if(wrs[u].need_insert && !wrs[u].inserted)
+                if(H5MF_xfree(dset->oloc.file, H5FD_MEM_DRAW, idx_info.dxpl_id, wrs[u].udata.chunk_block.offset, (hsize_t)wrs[u].nbytes) < 0)
+                    HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
+
+    /* Release the space reserved for chunks that weren't placed */
+    if(reserve.length > 0 && H5F_addr_defined(reserve.offset))
+        if(H5MF_xfree(dset->oloc.file, H5FD_MEM_DRAW, idx_info.dxpl_id, reserve.offset, reserve.length) < 0)
+            HDONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free reserved file space")
+    if(run_buf)
+        run_buf = H5FL_BLK_FREE(chunk, run_buf);
+    if(wrs)
+        wrs = (H5D_chunk_direct_wr_t *)H5MM_xfree(wrs);
+#ifdef H5_DEBUG_BUILD
+    if(md_dxpl_generated && H5I_dec_ref(io_info.md_dxpl_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't close metadata dxpl")
+#endif /* H5_DEBUG_BUILD */
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5D__chunk_direct_write_multi() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_direct_read
@@ -574,7 +1014,7 @@ H5D__chunk_direct_read(const H5D_t *dset, hid_t dxpl_id, hsize_t *offset,
         hbool_t flush;
 
         /* Sanity checks  */
-        HDassert(udata.idx_hint < rdcc->nslots);
+        HDassert(udata.idx_hint < rdcc->slot_nalloc);
         HDassert(rdcc->slot[udata.idx_hint]);
 
         flush = (ent->dirty == TRUE) ? TRUE : FALSE;
@@ -619,38 +1059,143 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:    H5D__get_chunk_storage_size
+ * Function:    H5D__chunk_direct_rd_cmp_idx
  *
- * Purpose:     Internal routine to read the storage size of a chunk on disk.
+ * Purpose:     Compares two chunk read requests by linear chunk index,
+ *              for qsort() and bsearch().
  *
- * Return:      Non-negative on success/Negative on failure
+ * Return:      -1, 0 or 1
  *
- * Programmer:  Matthew Strong (GE Healthcare)
- *              20 October 2016
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_rd_cmp_idx(const void *_rd1, const void *_rd2)
+{
+    const H5D_chunk_direct_rd_t *rd1 = (const H5D_chunk_direct_rd_t *)_rd1;
+    const H5D_chunk_direct_rd_t *rd2 = (const H5D_chunk_direct_rd_t *)_rd2;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    FUNC_LEAVE_NOAPI(rd1->chunk_idx < rd2->chunk_idx ? -1 : (rd1->chunk_idx > rd2->chunk_idx ? 1 : 0))
+} /* end H5D__chunk_direct_rd_cmp_idx() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_rd_cmp_addr
+ *
+ * Purpose:     Compares two chunk read requests by file address, for
+ *              qsort().  Chunks that don't exist sort last.
+ *
+ * Return:      -1, 0 or 1
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_rd_cmp_addr(const void *_rd1, const void *_rd2)
+{
+    const H5D_chunk_direct_rd_t *rd1 = (const H5D_chunk_direct_rd_t *)_rd1;
+    const H5D_chunk_direct_rd_t *rd2 = (const H5D_chunk_direct_rd_t *)_rd2;
+    int ret_value = 0;                  /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    if(!H5F_addr_defined(rd1->addr))
+        ret_value = H5F_addr_defined(rd2->addr) ? 1 : 0;
+    else if(!H5F_addr_defined(rd2->addr))
+        ret_value = -1;
+    else
+        ret_value = H5F_addr_cmp(rd1->addr, rd2->addr);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_direct_rd_cmp_addr() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_rd_cb
+ *
+ * Purpose:     Callback when walking the chunk index for
+ *              H5D__chunk_direct_read_multi(): records the location of
+ *              the chunk in all the requests for it.
+ *
+ * Return:      H5_ITER_CONT
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5D__chunk_direct_rd_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
+{
+    H5D_chunk_it_ud6_t *udata = (H5D_chunk_it_ud6_t *)_udata;  /* User data for callback */
+    H5D_chunk_direct_rd_t key;          /* Request to search for */
+    H5D_chunk_direct_rd_t *rd;          /* Request for the chunk */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    key.chunk_idx = H5VM_array_offset_pre(udata->common.layout->ndims - 1, udata->common.layout->down_chunks, chunk_rec->scaled);
+    if(NULL != (rd = (H5D_chunk_direct_rd_t *)HDbsearch(&key, udata->rds, udata->nrds, sizeof(H5D_chunk_direct_rd_t), H5D__chunk_direct_rd_cmp_idx))) {
+        /* Back up to the first request for the chunk */
+        while(rd > udata->rds && (rd - 1)->chunk_idx == key.chunk_idx)
+            rd--;
+
+        for(; rd < udata->rds + udata->nrds && rd->chunk_idx == key.chunk_idx; rd++) {
+            rd->addr = chunk_rec->chunk_addr;
+            rd->nbytes = chunk_rec->nbytes;
+            rd->filter_mask = chunk_rec->filter_mask;
+        } /* end for */
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(H5_ITER_CONT)
+} /* end H5D__chunk_direct_rd_cb() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_direct_read_multi
+ *
+ * Purpose:     Internal routine to read several chunks directly from the
+ *              file.  OFFSETS holds the logical offsets of the NCHUNKS
+ *              chunks, 'ndims' values each, on chunk boundaries.  The
+ *              filter masks and stored sizes of the chunks are returned
+ *              in FILTERS and NBYTES, and unless BUFS is NULL, the stored
+ *              chunks in the buffers it points to.  Chunks that don't
+ *              exist are reported with a size of zero.
+ *
+ *              Dirty cached chunks are written back first.  The chunks
+ *              are then found with a lookup per chunk or, when they are a
+ *              large part of the dataset, with a single walk over the
+ *              chunk index.  They are read in file address order, with
+ *              chunks that are adjacent in the file read at once, up to
+ *              the file's sieve buffer size.
+ *
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 herr_t
-H5D__get_chunk_storage_size(H5D_t *dset, hid_t dxpl_id, const hsize_t *offset, hsize_t *storage_size)
+H5D__chunk_direct_read_multi(const H5D_t *dset, hid_t dxpl_id, size_t nchunks,
+    const hsize_t *offsets, uint32_t *filters, hsize_t *nbytes, void **bufs)
 {
     const H5O_layout_t *layout = &(dset->shared->layout);    /* Dataset layout */
     const H5D_rdcc_t   *rdcc = &(dset->shared->cache.chunk); /* raw data chunk cache */
-    hsize_t scaled[H5S_MAX_RANK];       /* Scaled coordinates for this chunk */
+    H5D_chunk_direct_rd_t *rds = NULL;  /* Chunk read requests */
+    H5D_chk_idx_info_t idx_info;        /* Chunked index info */
     H5D_io_info_t io_info;              /* to hold the dset and two dxpls (meta and raw data) */
-    H5D_chunk_ud_t     udata;           /* User data for querying chunk info */
     H5D_dxpl_cache_t   _dxpl_cache;     /* Data transfer property cache buffer */
     H5D_dxpl_cache_t   *dxpl_cache = &_dxpl_cache; /* Data transfer property cache */
+    hbool_t dxpl_cache_init = FALSE;    /* Whether the DXPL cache was filled */
+    unsigned ndims = dset->shared->ndims; /* Rank of dataset */
+    uint8_t *run_buf = NULL;            /* Buffer for reading adjacent chunks at once */
+    size_t run_buf_size;                /* Size of run_buf */
+    size_t u, v;                        /* Local index variables */
     hbool_t md_dxpl_generated = FALSE;  /* bool to indicate whether we should free the md_dxpl_id at exit */
-    herr_t             ret_value = SUCCEED;        /* Return value */
+    herr_t ret_value = SUCCEED;         /* Return value */
 
-    FUNC_ENTER_STATIC_TAG(dxpl_id, dset->oloc.addr, FAIL)
+    FUNC_ENTER_PACKAGE_TAG(dxpl_id, dset->oloc.addr, FAIL)
 
     /* Check args */
     HDassert(dset && H5D_CHUNKED == layout->type);
-    HDassert(offset);
-    HDassert(storage_size);
+    HDassert(offsets || nchunks == 0);
 
-    *storage_size = 0;
+    if(nchunks == 0)
+        HGOTO_DONE(SUCCEED)
 
     io_info.dset = dset;
     io_info.raw_dxpl_id = dxpl_id;
@@ -663,58 +1208,239 @@ H5D__get_chunk_storage_size(H5D_t *dset, hid_t dxpl_id, const hsize_t *offset, h
     md_dxpl_generated = TRUE;
 #endif /* H5_DEBUG_BUILD */
 
-    /* Allocate dataspace and initialize it if it hasn't been. */
-    if(!(*layout->ops->is_space_alloc)(&layout->storage))
-        HGOTO_DONE(SUCCEED)
-
-    /* Calculate the index of this chunk */
-    H5VM_chunk_scaled(dset->shared->ndims, offset, layout->u.chunk.dim, scaled);
-    scaled[dset->shared->ndims] = 0;
-
-    /* Reset fields about the chunk we are looking for */
-    udata.chunk_block.offset = HADDR_UNDEF;
-    udata.chunk_block.length = 0;
-    udata.idx_hint = UINT_MAX;
-
-    /* Find out the file address of the chunk */
-    if(H5D__chunk_lookup(dset, io_info.md_dxpl_id, scaled, &udata) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
-
-    /* Sanity check */
-    HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
-            (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
-
-    /* The requested chunk is not in cache or on disk */
-    if(!H5F_addr_defined(udata.chunk_block.offset) && UINT_MAX == udata.idx_hint)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk storage is not allocated")
+    /* Set up the requests */
+    if(NULL == (rds = (H5D_chunk_direct_rd_t *)H5MM_malloc(nchunks * sizeof(H5D_chunk_direct_rd_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk read requests")
+    for(u = 0; u < nchunks; u++) {
+        H5D_chunk_direct_rd_t *rd = &rds[u];
+        unsigned idx;                   /* Index of chunk in cache */
+
+        H5VM_chunk_scaled(ndims, offsets + u * ndims, layout->u.chunk.dim, rd->scaled);
+        rd->scaled[ndims] = 0;
+        rd->chunk_idx = H5VM_array_offset_pre(ndims, layout->u.chunk.down_chunks, rd->scaled);
+        rd->addr = HADDR_UNDEF;
+        rd->nbytes = 0;
+        rd->filter_mask = 0;
+        rd->req = u;
+
+        /* Write the chunk back if it's dirty in the cache */
+        if(rdcc->nslots > 0 && UINT_MAX != (idx = H5D__chunk_cache_find(dset->shared, rd->scaled))) {
+            H5D_rdcc_ent_t *ent = rdcc->slot[idx];
+
+            if(ent->dirty && !ent->locked) {
+                if(!dxpl_cache_init) {
+                    if(H5D__get_dxpl_cache(io_info.raw_dxpl_id, &dxpl_cache) < 0)
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+                    dxpl_cache_init = TRUE;
+                } /* end if */
+                if(H5D__chunk_flush_entry(dset, io_info.md_dxpl_id, dxpl_cache, ent, FALSE, NULL) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
+            } /* end if */
+        } /* end if */
+    } /* end for */
 
-    /* Check if there are filters registered to the dataset */
-    if( dset->shared->dcpl_cache.pline.nused > 0 ) {
-        /* Check if the requested chunk exists in the chunk cache */
-        if(UINT_MAX != udata.idx_hint) {
-            H5D_rdcc_ent_t *ent = rdcc->slot[udata.idx_hint];
+    /* Look the chunks up in the index, unless no chunk was written yet */
+    if((*layout->ops->is_space_alloc)(&layout->storage)) {
+        /* Compose chunked index info struct */
+        idx_info.f = dset->oloc.file;
+        idx_info.dxpl_id = io_info.md_dxpl_id;
+        idx_info.pline = &dset->shared->dcpl_cache.pline;
+        idx_info.layout = &dset->shared->layout.u.chunk;
+        idx_info.storage = &dset->shared->layout.storage.u.chunk;
 
-            /* Sanity checks  */
-            HDassert(udata.idx_hint < rdcc->nslots);
-            HDassert(rdcc->slot[udata.idx_hint]);
+        /* Walk the whole index once if the chunks are a large part of the
+         * dataset, otherwise look them up one by one.  The cache isn't used
+         * for the lookups, it doesn't know the chunks' filter masks.
+         */
+        if((hsize_t)nchunks * 4 >= layout->u.chunk.nchunks) {
+            H5D_chunk_it_ud6_t udata;   /* User data for iteration callback */
 
-            /* If the cached chunk is dirty, it must be flushed to get accurate size */
-            if( ent->dirty == TRUE ) {
-                /* Fill the DXPL cache values for later use */
-                if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+            HDqsort(rds, nchunks, sizeof(H5D_chunk_direct_rd_t), H5D__chunk_direct_rd_cmp_idx);
 
-                /* Flush the chunk to disk and clear the cache entry */
-                if(H5D__chunk_cache_evict(dset, io_info.md_dxpl_id, dxpl_cache, rdcc->slot[udata.idx_hint], TRUE) < 0)
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+            HDmemset(&udata, 0, sizeof(udata));
+            udata.common.layout = &layout->u.chunk;
+            udata.common.storage = &layout->storage.u.chunk;
+            udata.rds = rds;
+            udata.nrds = nchunks;
+            if((layout->storage.u.chunk.ops->iterate)(&idx_info, H5D__chunk_direct_rd_cb, &udata) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to iterate over chunk index")
+        } /* end if */
+        else
+            for(u = 0; u < nchunks; u++) {
+                H5D_chunk_ud_t udata;   /* User data for querying chunk info */
 
-                /* Reset fields about the chunk we are looking for */
+                udata.common.layout = &layout->u.chunk;
+                udata.common.storage = &layout->storage.u.chunk;
+                udata.common.scaled = rds[u].scaled;
                 udata.chunk_block.offset = HADDR_UNDEF;
                 udata.chunk_block.length = 0;
+                udata.filter_mask = 0;
+                udata.new_unfilt_chunk = FALSE;
                 udata.idx_hint = UINT_MAX;
+                if((layout->storage.u.chunk.ops->get_addr)(&idx_info, &udata) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't query chunk address")
 
-                /* Get the new file address / chunk size after flushing */
-                if(H5D__chunk_lookup(dset, io_info.md_dxpl_id, scaled, &udata) < 0)
+                rds[u].addr = udata.chunk_block.offset;
+                rds[u].nbytes = udata.chunk_block.length;
+                rds[u].filter_mask = udata.filter_mask;
+            } /* end for */
+    } /* end if */
+
+    /* Return the filter masks and sizes */
+    for(u = 0; u < nchunks; u++) {
+        if(!H5F_addr_defined(rds[u].addr))
+            rds[u].nbytes = 0;
+        if(filters)
+            filters[rds[u].req] = rds[u].filter_mask;
+        if(nbytes)
+            nbytes[rds[u].req] = rds[u].nbytes;
+    } /* end for */
+    if(!bufs)
+        HGOTO_DONE(SUCCEED)
+
+    /* Read the chunks in file address order, adjacent chunks at once */
+    HDqsort(rds, nchunks, sizeof(H5D_chunk_direct_rd_t), H5D__chunk_direct_rd_cmp_addr);
+    run_buf_size = H5F_SIEVE_BUF_SIZE(dset->oloc.file);
+    for(u = 0; u < nchunks && H5F_addr_defined(rds[u].addr); u = v) {
+        hsize_t run_nbytes = rds[u].nbytes;     /* Bytes in run of adjacent chunks */
+
+        /* Find the end of the run, a chunk requested twice is read twice */
+        for(v = u + 1; v < nchunks && H5F_addr_defined(rds[v].addr); v++)
+            if(!H5F_addr_eq(rds[v - 1].addr + rds[v - 1].nbytes, rds[v].addr)
+                    || run_nbytes + rds[v].nbytes > run_buf_size)
+                break;
+            else
+                run_nbytes += rds[v].nbytes;
+
+        if(v == u + 1) {
+            if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, rds[u].addr, (size_t)rds[u].nbytes, io_info.raw_dxpl_id, bufs[rds[u].req]) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+        } /* end if */
+        else {
+            size_t w;                   /* Local index variable */
+            size_t buf_off = 0;         /* Offset of chunk in run buffer */
+
+            if(NULL == run_buf && NULL == (run_buf = H5FL_BLK_MALLOC(chunk, run_buf_size)))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunks")
+            if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, rds[u].addr, (size_t)run_nbytes, io_info.raw_dxpl_id, run_buf) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunks")
+            for(w = u; w < v; w++) {
+                HDmemcpy(bufs[rds[w].req], run_buf + buf_off, (size_t)rds[w].nbytes);
+                buf_off += (size_t)rds[w].nbytes;
+            } /* end for */
+        } /* end else */
+    } /* end for */
+
+done:
+    if(run_buf)
+        run_buf = H5FL_BLK_FREE(chunk, run_buf);
+    if(rds)
+        rds = (H5D_chunk_direct_rd_t *)H5MM_xfree(rds);
+#ifdef H5_DEBUG_BUILD
+    if(md_dxpl_generated && H5I_dec_ref(io_info.md_dxpl_id) < 0)
+        HDONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "can't close metadata dxpl")
+#endif /* H5_DEBUG_BUILD */
+    FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
+} /* end H5D__chunk_direct_read_multi() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__get_chunk_storage_size
+ *
+ * Purpose:     Internal routine to read the storage size of a chunk on disk.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ * Programmer:  Matthew Strong (GE Healthcare)
+ *              20 October 2016
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__get_chunk_storage_size(H5D_t *dset, hid_t dxpl_id, const hsize_t *offset, hsize_t *storage_size)
+{
+    const H5O_layout_t *layout = &(dset->shared->layout);    /* Dataset layout */
+    const H5D_rdcc_t   *rdcc = &(dset->shared->cache.chunk); /* raw data chunk cache */
+    hsize_t scaled[H5S_MAX_RANK];       /* Scaled coordinates for this chunk */
+    H5D_io_info_t io_info;              /* to hold the dset and two dxpls (meta and raw data) */
+    H5D_chunk_ud_t     udata;           /* User data for querying chunk info */
+    H5D_dxpl_cache_t   _dxpl_cache;     /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t   *dxpl_cache = &_dxpl_cache; /* Data transfer property cache */
+    hbool_t md_dxpl_generated = FALSE;  /* bool to indicate whether we should free the md_dxpl_id at exit */
+    herr_t             ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC_TAG(dxpl_id, dset->oloc.addr, FAIL)
+
+    /* Check args */
+    HDassert(dset && H5D_CHUNKED == layout->type);
+    HDassert(offset);
+    HDassert(storage_size);
+
+    *storage_size = 0;
+
+    io_info.dset = dset;
+    io_info.raw_dxpl_id = dxpl_id;
+    io_info.md_dxpl_id = dxpl_id;
+
+    /* set the dxpl IO type for sanity checking at the FD layer */
+#ifdef H5_DEBUG_BUILD
+    if(H5D_set_io_info_dxpls(&io_info, dxpl_id) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't set metadata and raw data dxpls")
+    md_dxpl_generated = TRUE;
+#endif /* H5_DEBUG_BUILD */
+
+    /* Allocate dataspace and initialize it if it hasn't been. */
+    if(!(*layout->ops->is_space_alloc)(&layout->storage))
+        HGOTO_DONE(SUCCEED)
+
+    /* Calculate the index of this chunk */
+    H5VM_chunk_scaled(dset->shared->ndims, offset, layout->u.chunk.dim, scaled);
+    scaled[dset->shared->ndims] = 0;
+
+    /* Reset fields about the chunk we are looking for */
+    udata.chunk_block.offset = HADDR_UNDEF;
+    udata.chunk_block.length = 0;
+    udata.idx_hint = UINT_MAX;
+
+    /* Find out the file address of the chunk */
+    if(H5D__chunk_lookup(dset, io_info.md_dxpl_id, scaled, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+    /* Sanity check */
+    HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) ||
+            (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+
+    /* The requested chunk is not in cache or on disk */
+    if(!H5F_addr_defined(udata.chunk_block.offset) && UINT_MAX == udata.idx_hint)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk storage is not allocated")
+
+    /* Check if there are filters registered to the dataset */
+    if( dset->shared->dcpl_cache.pline.nused > 0 ) {
+        /* Check if the requested chunk exists in the chunk cache */
+        if(UINT_MAX != udata.idx_hint) {
+            H5D_rdcc_ent_t *ent = rdcc->slot[udata.idx_hint];
+
+            /* Sanity checks  */
+            HDassert(udata.idx_hint < rdcc->slot_nalloc);
+            HDassert(rdcc->slot[udata.idx_hint]);
+
+            /* If the cached chunk is dirty, it must be flushed to get accurate size */
+            if( ent->dirty == TRUE ) {
+                /* Fill the DXPL cache values for later use */
+                if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+
+                /* Flush the chunk to disk and clear the cache entry */
+                if(H5D__chunk_cache_evict(dset, io_info.md_dxpl_id, dxpl_cache, rdcc->slot[udata.idx_hint], TRUE) < 0)
+                    HGOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "unable to evict chunk")
+
+                /* Reset fields about the chunk we are looking for */
+                udata.chunk_block.offset = HADDR_UNDEF;
+                udata.chunk_block.length = 0;
+                udata.idx_hint = UINT_MAX;
+
+                /* Get the new file address / chunk size after flushing */
+                if(H5D__chunk_lookup(dset, io_info.md_dxpl_id, scaled, &udata) < 0)
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
             }
         }
@@ -816,6 +1542,11 @@ H5D__chunk_set_info(const H5D_t *dset)
     if(H5D__chunk_set_info_real(&dset->shared->layout.u.chunk, dset->shared->ndims, dset->shared->curr_dims, dset->shared->max_dims) < 0)
 	HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set layout's chunk info")
 
+    /* The chunk address cache is keyed by the chunks' linear indices, which
+     * depend on the dataset's extent
+     */
+    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk);
+
     /* Call the index's "resize" callback */
     if(dset->shared->layout.storage.u.chunk.ops->resize && (dset->shared->layout.storage.u.chunk.ops->resize)(&dset->shared->layout.u.chunk) < 0)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "unable to resize chunk index information")
@@ -991,24 +1722,70 @@ H5D__chunk_init(H5F_t *f, hid_t dxpl_id, const H5D_t *dset, hid_t dapl_id)
 
     if(H5P_get(dapl, H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME, &rdcc->nbytes_max) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get data cache byte size")
-    if(rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT)
-        rdcc->nbytes_max = H5F_RDCC_NBYTES(f);
+    if(rdcc->nbytes_max == H5D_CHUNK_CACHE_NBYTES_DEFAULT) {
+        /* With a file-wide shared chunk cache, the dataset is only limited by
+         *      the shared budget, unless a byte size was set on the DAPL.
+         */
+        if(H5F_RDCC_SHARED(f)->nbytes_max > 0)
+            rdcc->nbytes_max = H5F_RDCC_SHARED(f)->nbytes_max;
+        else
+            rdcc->nbytes_max = H5F_RDCC_NBYTES(f);
+    } /* end if */
 
     if(H5P_get(dapl, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &rdcc->w0) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get preempt read chunks")
     if(rdcc->w0 < 0)
         rdcc->w0 = H5F_RDCC_W0(f);
 
+    if(H5P_get(dapl, H5D_ACS_DATA_CACHE_POLICY_NAME, &rdcc->policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get chunk cache replacement policy")
+
+    if(H5P_get(dapl, H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_NAME, &rdcc->filter_nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get number of chunk write back threads")
+
+    if(H5P_get(dapl, H5D_ACS_DATA_CACHE_PREFETCH_NAME, &rdcc->prefetch_nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get chunk read-ahead")
+
+    if(H5P_get(dapl, H5D_ACS_DATA_CACHE_CINFO_NBYTES_NAME, &rdcc->cinfo_nbytes_max) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET,FAIL, "can't get chunk address cache size")
+
     /* If nbytes_max or nslots is 0, set them both to 0 and avoid allocating space */
     if(!rdcc->nbytes_max || !rdcc->nslots)
         rdcc->nbytes_max = rdcc->nslots = 0;
     else {
-        rdcc->slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, rdcc->nslots);
+        /* The hash table starts small and grows as chunks are cached; the
+         *      number of slots requested is no longer used for sizing.
+         */
+        rdcc->slot_nalloc = H5D_RDCC_SLOTS_MIN;
+        rdcc->slot_nbits = H5VM_log2_gen((uint64_t)H5D_RDCC_SLOTS_MIN);
+        rdcc->slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, rdcc->slot_nalloc);
         if(NULL == rdcc->slot)
             HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed")
 
         /* Reset any cached chunk info for this dataset */
-        H5D__chunk_cinfo_cache_reset(&(rdcc->last));
+        H5D__chunk_cinfo_cache_reset(rdcc);
+
+        /* Allocate the 2Q ghost ring, sized to remember half as many
+         *      chunks as fit in the cache.
+         */
+        if(H5D_CHUNK_CACHE_POLICY_2Q == rdcc->policy) {
+            HDassert(dset->shared->layout.u.chunk.size > 0);
+            rdcc->nghosts_max = MAX(1, (rdcc->nbytes_max / dset->shared->layout.u.chunk.size) / 2);
+            if(NULL == (rdcc->ghost = (hsize_t *)H5MM_malloc(rdcc->nghosts_max * dset->shared->ndims * sizeof(hsize_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk cache ghosts")
+
+            /* Index the ghosts with a hash table at most half full */
+            rdcc->ghost_nslots = (size_t)H5VM_power2up((hsize_t)(2 * rdcc->nghosts_max));
+            rdcc->ghost_nbits = H5VM_log2_gen((uint64_t)rdcc->ghost_nslots);
+            if(NULL == (rdcc->ghost_slot = (size_t *)H5MM_calloc(rdcc->ghost_nslots * sizeof(size_t))))
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk cache ghost index")
+        } /* end if */
+
+        /* Join the file-wide shared chunk cache, if the file has one */
+        if(H5F_RDCC_SHARED(f)->nbytes_max > 0) {
+            rdcc->shared_cache = H5F_RDCC_SHARED(f);
+            rdcc->owner = dset;
+        } /* end if */
     } /* end else */
 
     /* Compute scaled dimension info, if dataset dims > 1 */
@@ -1176,30 +1953,9 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
         fm->sel_chunks = NULL;
         fm->use_single = TRUE;
 
-        /* Initialize single chunk dataspace */
-        if(NULL == dataset->shared->cache.chunk.single_space) {
-            /* Make a copy of the dataspace for the dataset */
-            if((dataset->shared->cache.chunk.single_space = H5S_copy(file_space, TRUE, FALSE)) == NULL)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
-
-            /* Resize chunk's dataspace dimensions to size of chunk */
-            if(H5S_set_extent_real(dataset->shared->cache.chunk.single_space, fm->chunk_dim) < 0)
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions")
-
-            /* Set the single chunk dataspace to 'all' selection */
-            if(H5S_select_all(dataset->shared->cache.chunk.single_space, TRUE) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection")
-        } /* end if */
-        fm->single_space = dataset->shared->cache.chunk.single_space;
-        HDassert(fm->single_space);
-
-        /* Allocate the single chunk information */
-        if(NULL == dataset->shared->cache.chunk.single_chunk_info) {
-            if(NULL == (dataset->shared->cache.chunk.single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
-                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
-        } /* end if */
-        fm->single_chunk_info = dataset->shared->cache.chunk.single_chunk_info;
-        HDassert(fm->single_chunk_info);
+        /* Initialize single chunk dataspace & information */
+        if(H5D__chunk_single_init(fm, dataset, file_space) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize single chunk information")
 
         /* Reset chunk template information */
         fm->mchunk_tmpl = NULL;
@@ -1210,14 +1966,7 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
     } /* end if */
     else {
         hbool_t sel_hyper_flag;         /* Whether file selection is a hyperslab */
-
-        /* Initialize skip list for chunk selections */
-        if(NULL == dataset->shared->cache.chunk.sel_chunks) {
-            if(NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections")
-        } /* end if */
-        fm->sel_chunks = dataset->shared->cache.chunk.sel_chunks;
-        HDassert(fm->sel_chunks);
+        htri_t regular = FALSE;         /* Whether the selection in each chunk can be worked out when it's visited */
 
         /* We are not using single element mode */
         fm->use_single = FALSE;
@@ -1228,6 +1977,49 @@ H5D__chunk_io_init(const H5D_io_info_t *io_info, const H5D_type_info_t *type_inf
         if((fm->msel_type = H5S_GET_SELECT_TYPE(mem_space)) < H5S_SEL_NONE)
             HGOTO_ERROR(H5E_DATASET, H5E_BADSELECT, FAIL, "unable to get type of selection")
 
+        /* Regular hyperslab selections of the same shape in the file and
+         * memory don't need a map of all the chunks selected: the selection
+         * in each chunk is set up in the shared 'single' chunk dataspace as
+         * the chunk is visited.  Collective I/O needs the whole map.
+         */
+#ifdef H5_HAVE_PARALLEL
+        if(!io_info->using_mpi_vfd)
+#endif /* H5_HAVE_PARALLEL */
+            if((regular = H5D__create_chunk_map_regular(fm)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to check for regular chunk selections")
+        if(regular) {
+            H5D_chunk_info_t *chunk_info;   /* Pointer to chunk information */
+
+            fm->sel_chunks = NULL;
+            fm->use_regular = TRUE;
+
+            /* Initialize single chunk dataspace & information */
+            if(H5D__chunk_single_init(fm, dataset, file_space) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "unable to initialize single chunk information")
+
+            /* The memory selection for each chunk is set in a copy of the
+             * memory dataspace
+             */
+            if(NULL == (fm->mchunk_tmpl = H5S_copy(mem_space, TRUE, FALSE)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
+
+            chunk_info = fm->single_chunk_info;
+            chunk_info->fspace = fm->single_space;
+            chunk_info->fspace_shared = TRUE;
+            chunk_info->mspace = fm->mchunk_tmpl;
+            chunk_info->mspace_shared = TRUE;
+
+            HGOTO_DONE(SUCCEED)
+        } /* end if */
+
+        /* Initialize skip list for chunk selections */
+        if(NULL == dataset->shared->cache.chunk.sel_chunks) {
+            if(NULL == (dataset->shared->cache.chunk.sel_chunks = H5SL_create(H5SL_TYPE_HSIZE, NULL)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTCREATE, FAIL, "can't create skip list for chunk selections")
+        } /* end if */
+        fm->sel_chunks = dataset->shared->cache.chunk.sel_chunks;
+        HDassert(fm->sel_chunks);
+
         /* If the selection is NONE or POINTS, set the flag to FALSE */
         if(fm->fsel_type == H5S_SEL_POINTS || fm->fsel_type == H5S_SEL_NONE)
             sel_hyper_flag = FALSE;
@@ -1602,89 +2394,384 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__create_chunk_file_map_hyper
+ * Function:	H5D__chunk_single_init
  *
- * Purpose:	Create all chunk selections in file.
+ * Purpose:	Points the chunk map at the dataset's 'single' chunk
+ *		dataspace and chunk information, creating them on first use.
  *
  * Return:	Non-negative on success/Negative on failure
  *
- * Programmer:	Quincey Koziol
- *		Thursday, May 29, 2003
- *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm, const H5D_io_info_t
-#ifndef H5_HAVE_PARALLEL
-    H5_ATTR_UNUSED
-#endif /* H5_HAVE_PARALLEL */
-    *io_info)
+H5D__chunk_single_init(H5D_chunk_map_t *fm, const H5D_t *dataset,
+    const H5S_t *file_space)
 {
-    hsize_t     sel_start[H5O_LAYOUT_NDIMS];   /* Offset of low bound of file selection */
-    hsize_t     sel_end[H5O_LAYOUT_NDIMS];   /* Offset of high bound of file selection */
-    hsize_t     sel_points;                 /* Number of elements in file selection */
-    hsize_t     start_coords[H5O_LAYOUT_NDIMS];   /* Starting coordinates of selection */
-    hsize_t     coords[H5O_LAYOUT_NDIMS];   /* Current coordinates of chunk */
-    hsize_t     end[H5O_LAYOUT_NDIMS];      /* Final coordinates of chunk */
-    hsize_t     chunk_index;                /* Index of chunk */
-    hsize_t     start_scaled[H5S_MAX_RANK]; /* Starting scaled coordinates of selection */
-    hsize_t 	scaled[H5S_MAX_RANK];       /* Scaled coordinates for this chunk */
-    int         curr_dim;                   /* Current dimension to increment */
-    unsigned    u;                          /* Local index variable */
     herr_t	ret_value = SUCCEED;        /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity check */
-    HDassert(fm->f_ndims>0);
-
-    /* Get number of elements selected in file */
-    sel_points = fm->nelmts;
+    /* Initialize single chunk dataspace */
+    if(NULL == dataset->shared->cache.chunk.single_space) {
+        /* Make a copy of the dataspace for the dataset */
+        if((dataset->shared->cache.chunk.single_space = H5S_copy(file_space, TRUE, FALSE)) == NULL)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy file space")
 
-    /* Get bounding box for selection (to reduce the number of chunks to iterate over) */
-    if(H5S_SELECT_BOUNDS(fm->file_space, sel_start, sel_end) < 0)
-        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+        /* Resize chunk's dataspace dimensions to size of chunk */
+        if(H5S_set_extent_real(dataset->shared->cache.chunk.single_space, fm->chunk_dim) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't adjust chunk dimensions")
 
-    /* Set initial chunk location & hyperslab size */
-    for(u = 0; u < fm->f_ndims; u++) {
-        scaled[u] = start_scaled[u] = sel_start[u] / fm->layout->u.chunk.dim[u];
-        coords[u] = start_coords[u] = scaled[u] * fm->layout->u.chunk.dim[u];
-        end[u] = (coords[u] + fm->chunk_dim[u]) - 1;
-    } /* end for */
+        /* Set the single chunk dataspace to 'all' selection */
+        if(H5S_select_all(dataset->shared->cache.chunk.single_space, TRUE) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "unable to set all selection")
+    } /* end if */
+    fm->single_space = dataset->shared->cache.chunk.single_space;
+    HDassert(fm->single_space);
 
-    /* Calculate the index of this chunk */
-    chunk_index = H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, scaled);
+    /* Allocate the single chunk information */
+    if(NULL == dataset->shared->cache.chunk.single_chunk_info) {
+        if(NULL == (dataset->shared->cache.chunk.single_chunk_info = H5FL_MALLOC(H5D_chunk_info_t)))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate chunk info")
+    } /* end if */
+    fm->single_chunk_info = dataset->shared->cache.chunk.single_chunk_info;
+    HDassert(fm->single_chunk_info);
 
-    /* Iterate through each chunk in the dataset */
-    while(sel_points) {
-        /* Check for intersection of temporary chunk and file selection */
-        /* (Casting away const OK - QAK) */
-        if(TRUE == H5S_hyper_intersect_block((H5S_t *)fm->file_space, coords, end)) {
-            H5S_t *tmp_fchunk;                  /* Temporary file dataspace */
-            H5D_chunk_info_t *new_chunk_info;   /* chunk information to insert into skip list */
-            hssize_t    schunk_points;          /* Number of elements in chunk selection */
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_single_init() */
 
-            /* Create "temporary" chunk for selection operations (copy file space) */
-            if(NULL == (tmp_fchunk = H5S_copy(fm->file_space, TRUE, FALSE)))
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_get_regular
+ *
+ * Purpose:	Gets the start, stride, count and block of a regular
+ *		hyperslab or 'all' selection, with contiguous blocks merged.
+ *
+ * Return:	TRUE if the selection is regular, FALSE if it isn't,
+ *		negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__chunk_get_regular(const H5S_t *space, H5S_sel_type sel_type,
+    hsize_t start[], hsize_t stride[], hsize_t count[], hsize_t block[])
+{
+    htri_t	ret_value = TRUE;           /* Return value */
 
-            /* Make certain selections are stored in span tree form (not "optimized hyperslab" or "all") */
-            if(H5S_hyper_convert(tmp_fchunk) < 0) {
-                (void)H5S_close(tmp_fchunk);
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to convert selection to span trees")
-            } /* end if */
+    FUNC_ENTER_STATIC
 
-            /* "AND" temporary chunk and current chunk */
-            if(H5S_select_hyperslab(tmp_fchunk,H5S_SELECT_AND,coords,NULL,fm->chunk_dim,NULL) < 0) {
-                (void)H5S_close(tmp_fchunk);
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't create chunk selection")
-            } /* end if */
+    if(H5S_SEL_ALL == sel_type) {
+        int sndims;                     /* Rank of dataspace */
+        unsigned u;                     /* Local index variable */
+
+        /* The whole extent is one block */
+        if((sndims = H5S_get_simple_extent_dims(space, block, NULL)) < 0)
+            HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "unable to get dimensions")
+        for(u = 0; u < (unsigned)sndims; u++) {
+            start[u] = 0;
+            stride[u] = 1;
+            count[u] = 1;
+        } /* end for */
+    } /* end if */
+    else if(H5S_SEL_HYPERSLABS == sel_type)
+        ret_value = H5S_hyper_get_regular(space, start, stride, count, block);
+    else
+        ret_value = FALSE;
 
-            /* Resize chunk's dataspace dimensions to size of chunk */
-            if(H5S_set_extent_real(tmp_fchunk,fm->chunk_dim) < 0) {
-                (void)H5S_close(tmp_fchunk);
-                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk dimensions")
-            } /* end if */
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_get_regular() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__create_chunk_map_regular
+ *
+ * Purpose:	Checks whether the chunks selected can be visited without
+ *		building a map of them, and sets up the information to work
+ *		out the selection in each chunk if they can.
+ *
+ *		That is possible when the file and memory selections are
+ *		regular hyperslabs (or 'all') with the same rank and
+ *		number and size of blocks in each dimension, and the part
+ *		of the file selection in every chunk is also a regular
+ *		hyperslab: there's only one block in the dimension, the
+ *		blocks don't cross boundaries of stride-aligned windows and
+ *		the chunk size is a multiple of the stride, or the blocks
+ *		don't cross chunk boundaries and the stride is a multiple
+ *		of the chunk size.  Memory blocks may also be merged into
+ *		one.  A file selection of a single block is left to the
+ *		chunk map, which maps it about as quickly and is then
+ *		faster to visit.
+ *
+ * Return:	TRUE if the chunks can be visited without a map, FALSE if
+ *		not, negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5D__create_chunk_map_regular(H5D_chunk_map_t *fm)
+{
+    hsize_t     fstart[H5S_MAX_RANK];       /* File selection offset */
+    hsize_t     fstride[H5S_MAX_RANK];      /* File selection stride */
+    hsize_t     fcount[H5S_MAX_RANK];       /* File selection block count */
+    hsize_t     fblock[H5S_MAX_RANK];       /* File selection block size */
+    hsize_t     mstart[H5S_MAX_RANK];       /* Memory selection offset */
+    hsize_t     mstride[H5S_MAX_RANK];      /* Memory selection stride */
+    hsize_t     mcount[H5S_MAX_RANK];       /* Memory selection block count */
+    hsize_t     mblock[H5S_MAX_RANK];       /* Memory selection block size */
+    htri_t      is_regular;                 /* Whether a selection is regular */
+    unsigned    u;                          /* Local index variable */
+    htri_t	ret_value = TRUE;           /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm->f_ndims > 0);
+
+    if(fm->m_ndims != fm->f_ndims)
+        HGOTO_DONE(FALSE)
+
+    /* Get the file & memory selections */
+    if((is_regular = H5D__chunk_get_regular(fm->file_space, fm->fsel_type, fstart, fstride, fcount, fblock)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection")
+    if(!is_regular)
+        HGOTO_DONE(FALSE)
+    for(u = 0; u < fm->f_ndims; u++)
+        if(fcount[u] > 1)
+            break;
+    if(u == fm->f_ndims)
+        HGOTO_DONE(FALSE)
+    if((is_regular = H5D__chunk_get_regular(fm->mem_space, fm->msel_type, mstart, mstride, mcount, mblock)) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory selection")
+    if(!is_regular)
+        HGOTO_DONE(FALSE)
+
+    fm->reg_nchunks = 1;
+    for(u = 0; u < fm->f_ndims; u++) {
+        H5D_chunk_reg_dim_t *rd = &fm->reg_dim[u];  /* Selection in this dimension */
+        hsize_t cdim = fm->chunk_dim[u];            /* Chunk size in this dimension */
+
+        /* (Empty selections are left to the chunk map) */
+        if(0 == fcount[u] || 0 == fblock[u])
+            HGOTO_DONE(FALSE)
+
+        rd->start = fstart[u];
+        rd->stride = fstride[u];
+        rd->count = fcount[u];
+        rd->block = fblock[u];
+        rd->mstart = mstart[u];
+
+        /* Check that the memory blocks match the file blocks */
+        if(mcount[u] == fcount[u] && mblock[u] == fblock[u])
+            rd->mstride = mstride[u];
+        else if(1 == mcount[u] && mblock[u] == fcount[u] * fblock[u])
+            rd->mstride = fblock[u];
+        else
+            HGOTO_DONE(FALSE)
+
+        /* Work out the chunks selected in this dimension */
+        rd->first_scaled = fstart[u] / cdim;
+        if(1 == fcount[u]) {
+            rd->scaled_step = 1;
+            rd->nchunks = ((fstart[u] + fblock[u] - 1) / cdim - rd->first_scaled) + 1;
+        } /* end if */
+        else if(0 == cdim % fstride[u] && (fstart[u] % fstride[u]) + fblock[u] <= fstride[u]) {
+            rd->scaled_step = 1;
+            rd->nchunks = ((fstart[u] + (fcount[u] - 1) * fstride[u] + fblock[u] - 1) / cdim - rd->first_scaled) + 1;
+        } /* end if */
+        else if(0 == fstride[u] % cdim && (fstart[u] % cdim) + fblock[u] <= cdim) {
+            rd->scaled_step = fstride[u] / cdim;
+            rd->nchunks = fcount[u];
+        } /* end if */
+        else
+            HGOTO_DONE(FALSE)
+
+        fm->reg_nchunks *= rd->nchunks;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__create_chunk_map_regular() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_map_regular_info
+ *
+ * Purpose:	Gets the information for a chunk of a regular chunk map,
+ *		setting the selections in the shared file & memory chunk
+ *		dataspaces.  NODE is the position of the chunk among the
+ *		chunks selected, in order of chunk index, plus one.
+ *
+ * Return:	Pointer to the chunk's information on success/NULL on
+ *		failure.  The information is overwritten by the next call.
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5D_chunk_info_t *
+H5D__chunk_map_regular_info(const H5D_chunk_map_t *fm, const H5SL_node_t *node)
+{
+    H5D_chunk_info_t *chunk_info = fm->single_chunk_info;  /* Chunk information */
+    hsize_t     start[H5O_LAYOUT_NDIMS];    /* Selection offset in chunk */
+    hsize_t     stride[H5O_LAYOUT_NDIMS];   /* Selection stride in chunk */
+    hsize_t     count[H5O_LAYOUT_NDIMS];    /* Number of blocks in chunk */
+    hsize_t     block[H5O_LAYOUT_NDIMS];    /* Size of blocks in chunk */
+    hsize_t     mstart[H5O_LAYOUT_NDIMS];   /* Memory selection offset */
+    hsize_t     mstride[H5O_LAYOUT_NDIMS];  /* Memory selection stride */
+    hsize_t     pos;                        /* Position of chunk among chunks selected */
+    hsize_t     npoints = 1;                /* Number of elements selected in chunk */
+    unsigned    u;                          /* Local index variable */
+    H5D_chunk_info_t *ret_value = NULL;     /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(fm->use_regular);
+    HDassert(node);
+    HDassert((hsize_t)(size_t)node <= fm->reg_nchunks);
+
+    /* Find the chunk's coordinates and the blocks in it, the chunks are
+     * visited in row-major order
+     */
+    pos = (hsize_t)(size_t)node - 1;
+    for(u = fm->f_ndims; u > 0; u--) {
+        const H5D_chunk_reg_dim_t *rd = &fm->reg_dim[u - 1];  /* Selection in this dimension */
+        hsize_t lo, hi;                 /* Bounds of chunk in this dimension */
+
+        chunk_info->scaled[u - 1] = rd->first_scaled + (pos % rd->nchunks) * rd->scaled_step;
+        pos /= rd->nchunks;
+        lo = chunk_info->scaled[u - 1] * fm->chunk_dim[u - 1];
+        hi = lo + fm->chunk_dim[u - 1];
+
+        if(1 == rd->count) {
+            /* Part of the one block that's in the chunk */
+            hsize_t first = MAX(lo, rd->start);
+            hsize_t end = MIN(hi, rd->start + rd->block);
+
+            start[u - 1] = first - lo;
+            stride[u - 1] = 1;
+            count[u - 1] = 1;
+            block[u - 1] = end - first;
+            mstart[u - 1] = rd->mstart + (first - rd->start);
+            mstride[u - 1] = 1;
+        } /* end if */
+        else {
+            /* Whole blocks that start in the chunk */
+            hsize_t first = (lo <= rd->start) ? 0 : (lo - rd->start + rd->stride - 1) / rd->stride;
+            hsize_t last = MIN(rd->count - 1, (hi - 1 - rd->start) / rd->stride);
+
+            HDassert(first <= last);
+            start[u - 1] = (rd->start + first * rd->stride) - lo;
+            stride[u - 1] = rd->stride;
+            count[u - 1] = (last - first) + 1;
+            block[u - 1] = rd->block;
+            mstart[u - 1] = rd->mstart + first * rd->mstride;
+            mstride[u - 1] = rd->mstride;
+        } /* end else */
+        npoints *= count[u - 1] * block[u - 1];
+    } /* end for */
+    chunk_info->scaled[fm->f_ndims] = 0;
+
+    /* Calculate the index of this chunk */
+    chunk_info->index = H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, chunk_info->scaled);
+    H5_CHECKED_ASSIGN(chunk_info->chunk_points, uint32_t, npoints, hsize_t);
+
+    /* Select the chunk's elements in the file & memory */
+    if(H5S_select_hyperslab(chunk_info->fspace, H5S_SELECT_SET, start, stride, count, block) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, NULL, "can't create chunk selection")
+    if(H5S_select_hyperslab(chunk_info->mspace, H5S_SELECT_SET, mstart, mstride, count, block) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, NULL, "can't create memory chunk selection")
+
+    ret_value = chunk_info;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_map_regular_info() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__create_chunk_file_map_hyper
+ *
+ * Purpose:	Create all chunk selections in file.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Quincey Koziol
+ *		Thursday, May 29, 2003
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__create_chunk_file_map_hyper(H5D_chunk_map_t *fm, const H5D_io_info_t
+#ifndef H5_HAVE_PARALLEL
+    H5_ATTR_UNUSED
+#endif /* H5_HAVE_PARALLEL */
+    *io_info)
+{
+    hsize_t     sel_start[H5O_LAYOUT_NDIMS];   /* Offset of low bound of file selection */
+    hsize_t     sel_end[H5O_LAYOUT_NDIMS];   /* Offset of high bound of file selection */
+    hsize_t     sel_points;                 /* Number of elements in file selection */
+    hsize_t     start_coords[H5O_LAYOUT_NDIMS];   /* Starting coordinates of selection */
+    hsize_t     coords[H5O_LAYOUT_NDIMS];   /* Current coordinates of chunk */
+    hsize_t     end[H5O_LAYOUT_NDIMS];      /* Final coordinates of chunk */
+    hsize_t     chunk_index;                /* Index of chunk */
+    hsize_t     start_scaled[H5S_MAX_RANK]; /* Starting scaled coordinates of selection */
+    hsize_t 	scaled[H5S_MAX_RANK];       /* Scaled coordinates for this chunk */
+    int         curr_dim;                   /* Current dimension to increment */
+    unsigned    u;                          /* Local index variable */
+    herr_t	ret_value = SUCCEED;        /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(fm->f_ndims>0);
+
+    /* Get number of elements selected in file */
+    sel_points = fm->nelmts;
+
+    /* Get bounding box for selection (to reduce the number of chunks to iterate over) */
+    if(H5S_SELECT_BOUNDS(fm->file_space, sel_start, sel_end) < 0)
+        HGOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection bound info")
+
+    /* Set initial chunk location & hyperslab size */
+    for(u = 0; u < fm->f_ndims; u++) {
+        scaled[u] = start_scaled[u] = sel_start[u] / fm->layout->u.chunk.dim[u];
+        coords[u] = start_coords[u] = scaled[u] * fm->layout->u.chunk.dim[u];
+        end[u] = (coords[u] + fm->chunk_dim[u]) - 1;
+    } /* end for */
+
+    /* Calculate the index of this chunk */
+    chunk_index = H5VM_array_offset_pre(fm->f_ndims, fm->layout->u.chunk.down_chunks, scaled);
+
+    /* Iterate through each chunk in the dataset */
+    while(sel_points) {
+        /* Check for intersection of temporary chunk and file selection */
+        /* (Casting away const OK - QAK) */
+        if(TRUE == H5S_hyper_intersect_block((H5S_t *)fm->file_space, coords, end)) {
+            H5S_t *tmp_fchunk;                  /* Temporary file dataspace */
+            H5D_chunk_info_t *new_chunk_info;   /* chunk information to insert into skip list */
+            hssize_t    schunk_points;          /* Number of elements in chunk selection */
+
+            /* Create "temporary" chunk for selection operations (copy file space) */
+            if(NULL == (tmp_fchunk = H5S_copy(fm->file_space, TRUE, FALSE)))
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL, "unable to copy memory space")
+
+            /* Make certain selections are stored in span tree form (not "optimized hyperslab" or "all") */
+            if(H5S_hyper_convert(tmp_fchunk) < 0) {
+                (void)H5S_close(tmp_fchunk);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to convert selection to span trees")
+            } /* end if */
+
+            /* "AND" temporary chunk and current chunk */
+            if(H5S_select_hyperslab(tmp_fchunk,H5S_SELECT_AND,coords,NULL,fm->chunk_dim,NULL) < 0) {
+                (void)H5S_close(tmp_fchunk);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't create chunk selection")
+            } /* end if */
+
+            /* Resize chunk's dataspace dimensions to size of chunk */
+            if(H5S_set_extent_real(tmp_fchunk,fm->chunk_dim) < 0) {
+                (void)H5S_close(tmp_fchunk);
+                HGOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk dimensions")
+            } /* end if */
 
             /* Move selection back to have correct offset in chunk */
             if(H5S_SELECT_ADJUST_U(tmp_fchunk, coords) < 0) {
@@ -2189,161 +3276,598 @@ done:
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_read
+ * Function:	H5D__chunk_filter_worker
  *
- * Purpose:	Read from a chunked dataset.
+ * Purpose:	Runs the I/O filter pipeline on the chunk buffers assigned
+ *		to one worker.  This is the start routine of the threads
+ *		created by H5D__chunk_filter_bufs(), so errors are only
+ *		recorded in the buffers' status fields.  The created
+ *		threads drop the errors the filters push, see
+ *		H5E_discard_thread_errors().
  *
- * Return:	Non-negative on success/Negative on failure
+ * Return:	NULL
  *
- * Programmer:	Raymond Lu
- *		Thursday, April 10, 2003
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5D__chunk_filter_worker(void *_worker)
+{
+    const H5D_chunk_filter_worker_t *worker = (const H5D_chunk_filter_worker_t *)_worker;
+    const H5D_chunk_filter_op_t *op = worker->op;
+    size_t u;                           /* Local index variable */
+
+#ifdef H5_HAVE_THREADSAFE
+    if(worker->own_thread)
+        (void)H5E_discard_thread_errors();
+#endif /* H5_HAVE_THREADSAFE */
+
+    for(u = worker->first; u < op->nbufs; u += op->nworkers) {
+        H5D_chunk_filt_t *filt = &op->bufs[u];
+
+        filt->status = H5Z_pipeline(op->pline, op->flags, &filt->filter_mask,
+                op->err_detect, op->filter_cb, &filt->nbytes,
+                &filt->buf_alloc, &filt->buf);
+    } /* end for */
+
+    return NULL;
+} /* end H5D__chunk_filter_worker() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_filter_bufs
+ *
+ * Purpose:	Runs the I/O filter pipeline PLINE in direction FLAGS on
+ *		NBUFS chunk buffers, spread over up to NTHREADS threads.
+ *		The calling thread is one of the workers and returns once
+ *		all buffers are done.  Without thread-safety the buffers are
+ *		filtered in turn.
+ *
+ *		The calling thread holds the library lock while the other
+ *		workers run.  A filter or filter callback that calls back
+ *		into the library would deadlock on a worker thread, so
+ *		only the built-in filters are run concurrently; any other
+ *		filter in the pipeline, or a filter callback, makes the
+ *		buffers be filtered in turn by the calling thread.
+ *
+ *		The built-in filters still allocate through H5MM and push
+ *		errors.  Errors pushed on the other workers are dropped.
+ *		The memory allocation sanity check (H5MM's block list) and
+ *		the H5Z_DEBUG filter statistics are global state without a
+ *		lock, so with either of them the buffers are filtered in
+ *		turn.  If a worker thread cannot be started, the calling
+ *		thread does its share of the buffers as well.
+ *
+ * Return:	Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
-    hsize_t H5_ATTR_UNUSED nelmts, const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
-    H5D_chunk_map_t *fm)
+H5D__chunk_filter_bufs(const H5O_pline_t *pline, unsigned flags,
+    unsigned nthreads, const H5D_dxpl_cache_t *dxpl_cache,
+    H5D_chunk_filt_t *bufs, size_t nbufs)
 {
-    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
-    H5D_io_info_t nonexistent_io_info;  /* "nonexistent" I/O info object */
-    H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
-    H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
-    H5D_io_info_t cpt_io_info;          /* Compact I/O info object */
-    H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
-    hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
-    uint32_t    src_accessed_bytes = 0; /* Total accessed size in a chunk */
-    hbool_t     skip_missing_chunks = FALSE;    /* Whether to skip missing chunks */
-    herr_t	ret_value = SUCCEED;	/*return value		*/
+    H5D_chunk_filter_op_t op;           /* Filter operation info */
+    H5D_chunk_filter_worker_t *workers = NULL;  /* Work assignments */
+#ifdef H5_HAVE_THREADSAFE
+    H5TS_thread_t *threads = NULL;      /* Worker threads */
+    size_t nstarted;                    /* Number of worker threads started */
+#endif /* H5_HAVE_THREADSAFE */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /* Sanity check */
-    HDassert(io_info);
-    HDassert(io_info->u.rbuf);
-    HDassert(type_info);
-    HDassert(fm);
+    /* Sanity checks */
+    HDassert(pline);
+    HDassert(dxpl_cache);
+    HDassert(bufs);
+
+    /* Set up the operation */
+    op.pline = pline;
+    op.flags = flags;
+    op.err_detect = dxpl_cache->err_detect;
+    op.filter_cb = dxpl_cache->filter_cb;
+    op.bufs = bufs;
+    op.nbufs = nbufs;
+#ifdef H5_HAVE_THREADSAFE
+    op.nworkers = MIN((size_t)nthreads, nbufs);
+    if(op.nworkers < 1)
+        op.nworkers = 1;
+
+    /* Keep application code on the calling thread */
+    if(dxpl_cache->filter_cb.func)
+        op.nworkers = 1;
+    for(u = 0; u < pline->nused && op.nworkers > 1; u++)
+        switch(pline->filter[u].id) {
+            case H5Z_FILTER_DEFLATE:
+            case H5Z_FILTER_SHUFFLE:
+            case H5Z_FILTER_FLETCHER32:
+            case H5Z_FILTER_SZIP:
+            case H5Z_FILTER_NBIT:
+            case H5Z_FILTER_SCALEOFFSET:
+                break;
 
-    /* Set up "nonexistent" I/O info object */
-    HDmemcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
-    nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
+            default:
+                op.nworkers = 1;
+                break;
+        } /* end switch */
+#if defined H5_MEMORY_ALLOC_SANITY_CHECK || defined H5Z_DEBUG
+    op.nworkers = 1;
+#endif /* H5_MEMORY_ALLOC_SANITY_CHECK || H5Z_DEBUG */
+#else /* H5_HAVE_THREADSAFE */
+    op.nworkers = 1;
+#endif /* H5_HAVE_THREADSAFE */
+
+    /* Assign every worker its share of the buffers */
+    if(NULL == (workers = (H5D_chunk_filter_worker_t *)H5MM_malloc(op.nworkers * sizeof(H5D_chunk_filter_worker_t))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter workers")
+    for(u = 0; u < op.nworkers; u++) {
+        workers[u].op = &op;
+        workers[u].first = u;
+        workers[u].own_thread = FALSE;
+    } /* end for */
 
-    /* Set up contiguous I/O info object */
-    HDmemcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
-    ctg_io_info.store = &ctg_store;
-    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
+#ifdef H5_HAVE_THREADSAFE
+    /* Start the other workers, then work alongside them */
+    if(op.nworkers > 1) {
+        if(NULL == (threads = (H5TS_thread_t *)H5MM_malloc((op.nworkers - 1) * sizeof(H5TS_thread_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for filter threads")
+        for(nstarted = 0; nstarted < op.nworkers - 1; nstarted++) {
+            workers[nstarted + 1].own_thread = TRUE;
+            if(H5TS_thread_create(&threads[nstarted], H5D__chunk_filter_worker, &workers[nstarted + 1]) < 0) {
+                workers[nstarted + 1].own_thread = FALSE;
+                break;
+            } /* end if */
+        } /* end for */
+        (void)H5D__chunk_filter_worker(&workers[0]);
 
-    /* Initialize temporary contiguous storage info */
-    H5_CHECKED_ASSIGN(ctg_store.contig.dset_size, hsize_t, io_info->dset->shared->layout.u.chunk.size, uint32_t);
+        /* Do the work of the workers that could not be started */
+        for(u = nstarted + 1; u < op.nworkers; u++)
+            (void)H5D__chunk_filter_worker(&workers[u]);
+        for(u = 0; u < nstarted; u++)
+            H5TS_wait_for_thread(threads[u]);
+    } /* end if */
+    else
+#endif /* H5_HAVE_THREADSAFE */
+        (void)H5D__chunk_filter_worker(&workers[0]);
 
-    /* Set up compact I/O info object */
-    HDmemcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
-    cpt_io_info.store = &cpt_store;
-    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+    /* Check the results */
+    for(u = 0; u < nbufs; u++)
+        if(bufs[u].status < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "data pipeline %s failed", (flags & H5Z_FLAG_REVERSE) ? "read" : "write")
 
-    /* Initialize temporary compact storage info */
-    cpt_store.compact.dirty = &cpt_dirty;
+done:
+#ifdef H5_HAVE_THREADSAFE
+    if(threads)
+        threads = (H5TS_thread_t *)H5MM_xfree(threads);
+#endif /* H5_HAVE_THREADSAFE */
+    if(workers)
+        workers = (H5D_chunk_filter_worker_t *)H5MM_xfree(workers);
 
-    {
-        const H5O_fill_t *fill = &(io_info->dset->shared->dcpl_cache.fill);    /* Fill value info */
-        H5D_fill_value_t fill_status;       /* Fill value status */
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_filter_bufs() */
 
-        /* Check the fill value status */
-        if(H5P_is_fill_value_defined(fill, &fill_status) < 0)
-            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_stage_reserve
+ *
+ * Purpose:	Makes room for staging NCHUNKS chunks.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_stage_reserve(H5D_rdcc_t *rdcc, size_t nchunks)
+{
+    herr_t ret_value = SUCCEED;         /* Return value */
 
-        /* If we are never to return fill values, or if we would return them
-         * but they aren't set, set the flag to skip missing chunks.
-         */
-        if(fill->fill_time == H5D_FILL_TIME_NEVER ||
-                (fill->fill_time == H5D_FILL_TIME_IFSET &&
-                 fill_status != H5D_FILL_VALUE_USER_DEFINED &&
-                 fill_status != H5D_FILL_VALUE_DEFAULT))
-            skip_missing_chunks = TRUE;
-    }
+    FUNC_ENTER_STATIC
 
-    /* Iterate through nodes in chunk skip list */
-    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
-    while(chunk_node) {
-        H5D_chunk_info_t *chunk_info;   /* Chunk information */
-        H5D_chunk_ud_t udata;		/* Chunk index pass-through	*/
+    /* Sanity check */
+    HDassert(rdcc);
+    HDassert(rdcc->nstaged == 0);
 
-        /* Get the actual chunk information from the skip list node */
-        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+    if(rdcc->staged_nalloc < nchunks) {
+        H5D_chunk_filt_t *staged;
 
-        /* Get the info for the chunk in the file */
-        if(H5D__chunk_lookup(io_info->dset, io_info->md_dxpl_id, chunk_info->scaled, &udata) < 0)
-            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        if(NULL == (staged = (H5D_chunk_filt_t *)H5MM_realloc(rdcc->staged, nchunks * sizeof(H5D_chunk_filt_t))))
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for staged chunks")
+        rdcc->staged = staged;
+        rdcc->staged_nalloc = nchunks;
+    } /* end if */
 
-        /* Sanity check */
-        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) || 
-                (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_stage_reserve() */
 
-        /* Check for non-existant chunk & skip it if appropriate */
-        if(H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint
-                || !skip_missing_chunks) {
-            H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
-            void *chunk = NULL;             /* Pointer to locked chunk buffer */
-            htri_t cacheable;               /* Whether the chunk is cacheable */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_stage_one
+ *
+ * Purpose:	Reads the chunk with scaled coordinates SCALED into the
+ *		next staged buffer, unless it doesn't exist in the file, is
+ *		in the cache already or is a partial edge chunk whose
+ *		filters are disabled.  The caller runs the filters.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_stage_one(const H5D_io_info_t *io_info, const hsize_t *scaled)
+{
+    const H5D_t *dset = io_info->dset;  /* Local pointer to the dataset info */
+    const H5O_layout_t *layout = &(dset->shared->layout); /* Dataset layout */
+    H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk); /* Raw data chunk cache */
+    H5D_chunk_ud_t udata;               /* Chunk index pass-through */
+    H5D_chunk_filt_t *filt;             /* Staged chunk */
+    herr_t ret_value = SUCCEED;         /* Return value */
 
-            /* Set chunk's [scaled] coordinates */
-            io_info->store->chunk.scaled = chunk_info->scaled;
+    FUNC_ENTER_STATIC
 
-            /* Determine if we should use the chunk cache */
-            if((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, FALSE)) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
-            if(cacheable) {
-                /* Load the chunk into cache and lock it. */
+    /* Sanity checks */
+    HDassert(scaled);
+    HDassert(rdcc->nstaged < rdcc->staged_nalloc);
 
-                /* Compute # of bytes accessed in chunk */
-                H5_CHECK_OVERFLOW(type_info->src_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
-                src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
+    if(H5D__chunk_lookup(dset, io_info->md_dxpl_id, scaled, &udata) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
 
-                /* Lock the chunk into the cache */
-                if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE, FALSE)))
-                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+    /* Skip chunks that don't need the filters run on them */
+    if(!H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint)
+        HGOTO_DONE(SUCCEED)
+    if((layout->u.chunk.flags & H5O_LAYOUT_CHUNK_DONT_FILTER_PARTIAL_BOUND_CHUNKS)
+            && H5D__chunk_is_partial_edge_chunk(dset->shared->ndims,
+                    layout->u.chunk.dim, scaled, dset->shared->curr_dims))
+        HGOTO_DONE(SUCCEED)
 
-                /* Set up the storage buffer information for this chunk */
-                cpt_store.compact.buf = chunk;
+    /* Stage the chunk */
+    filt = &rdcc->staged[rdcc->nstaged];
+    filt->ent = NULL;
+    HDmemcpy(filt->scaled, scaled, sizeof(hsize_t) * dset->shared->ndims);
+    filt->addr = udata.chunk_block.offset;
+    H5_CHECKED_ASSIGN(filt->nbytes, size_t, udata.chunk_block.length, hsize_t);
+    filt->buf_alloc = filt->nbytes;
+    filt->filter_mask = udata.filter_mask;
+    filt->status = SUCCEED;
+    if(NULL == (filt->buf = H5D__chunk_mem_alloc(filt->nbytes, &(dset->shared->dcpl_cache.pline))))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for raw data chunk")
+    rdcc->nstaged++;
 
-                /* Point I/O info at contiguous I/O info for this chunk */
-                chk_io_info = &cpt_io_info;
-            } /* end if */
-            else if(H5F_addr_defined(udata.chunk_block.offset)) {
-                /* Set up the storage address information for this chunk */
-                ctg_store.contig.dset_addr = udata.chunk_block.offset;
+    if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, filt->addr, filt->nbytes, io_info->raw_dxpl_id, filt->buf) < 0)
+        HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
 
-                /* Point I/O info at temporary I/O info for this chunk */
-                chk_io_info = &ctg_io_info;
-            } /* end else if */
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_stage_one() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_stage_filtered
+ *
+ * Purpose:	Reads the next batch of chunks in the chunk map, starting
+ *		at *AHEAD_NODE, and runs their filters concurrently.  Only
+ *		filtered chunks that exist in the file and aren't in the
+ *		cache are staged; H5D__chunk_lock() takes them from the
+ *		stage instead of reading them itself.  On return *AHEAD_NODE
+ *		is the first chunk after the batch.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_stage_filtered(const H5D_io_info_t *io_info,
+    const H5D_chunk_map_t *fm, H5SL_node_t **ahead_node)
+{
+    const H5D_t *dset = io_info->dset;  /* Local pointer to the dataset info */
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk); /* Raw data chunk cache */
+    H5SL_node_t *node;                  /* Current node in chunk skip list */
+    size_t nbatch;                      /* Number of chunks in a batch */
+    size_t u;                           /* Local index variable */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(fm);
+    HDassert(ahead_node);
+    HDassert(pline->nused > 0);
+
+    /* Release chunks staged for the previous batch that weren't used */
+    H5D__chunk_stage_discard(rdcc, pline);
+
+    /* Keep every thread busy with two chunks at a time */
+    nbatch = 2 * (size_t)io_info->dxpl_cache->filter_nthreads;
+    if(H5D__chunk_stage_reserve(rdcc, nbatch) < 0)
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate staged chunks")
+
+    /* Read the chunks of the batch in file index order */
+    for(u = 0, node = *ahead_node; node && u < nbatch; u++, node = H5D_CHUNK_GET_NEXT_NODE(fm, node)) {
+        const H5D_chunk_info_t *chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, node);
+
+        if(NULL == chunk_info)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't get chunk information")
+        if(H5D__chunk_stage_one(io_info, chunk_info->scaled) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read ahead raw data chunk")
+    } /* end for */
+    *ahead_node = node;
+
+    /* Undo the filters on all the chunks at once */
+    if(rdcc->nstaged > 0)
+        if(H5D__chunk_filter_bufs(pline, H5Z_FLAG_REVERSE, io_info->dxpl_cache->filter_nthreads,
+                io_info->dxpl_cache, rdcc->staged, rdcc->nstaged) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_stage_filtered() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_stage_take
+ *
+ * Purpose:	Looks for the chunk with scaled coordinates SCALED, stored
+ *		at ADDR, among the staged chunks.  If it's there, ownership
+ *		of its unfiltered buffer passes to the caller.
+ *
+ * Return:	TRUE if the chunk was staged, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_stage_take(H5D_rdcc_t *rdcc, unsigned ndims, const hsize_t *scaled,
+    haddr_t addr, void **buf, size_t *nbytes, unsigned *filter_mask)
+{
+    size_t u;                           /* Local index variable */
+    hbool_t ret_value = FALSE;          /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(rdcc);
+    HDassert(scaled);
+    HDassert(buf);
+    HDassert(nbytes);
+    HDassert(filter_mask);
+
+    for(u = 0; u < rdcc->nstaged; u++) {
+        H5D_chunk_filt_t *filt = &rdcc->staged[u];
+
+        if(filt->buf && H5F_addr_eq(filt->addr, addr)
+                && !HDmemcmp(filt->scaled, scaled, sizeof(hsize_t) * ndims)) {
+            *buf = filt->buf;
+            *nbytes = filt->nbytes;
+            *filter_mask = filt->filter_mask;
+            filt->buf = NULL;
+            HGOTO_DONE(TRUE)
+        } /* end if */
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_stage_take() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_stage_discard
+ *
+ * Purpose:	Releases the buffers of staged chunks that were not taken.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_stage_discard(H5D_rdcc_t *rdcc, const H5O_pline_t *pline)
+{
+    size_t u;                           /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(rdcc);
+
+    for(u = 0; u < rdcc->nstaged; u++)
+        if(rdcc->staged[u].buf)
+            rdcc->staged[u].buf = H5D__chunk_mem_xfree(rdcc->staged[u].buf, pline);
+    rdcc->nstaged = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_stage_discard() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_prefetch_note
+ *
+ * Purpose:	Records that the chunk with scaled coordinates SCALED was
+ *		read, for detecting a constant stride between the chunks
+ *		read.  Consecutive accesses of the same chunk are ignored.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_prefetch_note(H5D_rdcc_t *rdcc, unsigned ndims, const hsize_t *scaled)
+{
+    hssize_t stride[H5O_LAYOUT_NDIMS];  /* Stride from the last chunk */
+    hbool_t same = TRUE;                /* Whether the stride is the current one */
+    hbool_t moved = FALSE;              /* Whether the chunk is a different one */
+    unsigned u;                         /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(rdcc);
+    HDassert(scaled);
+
+    if(rdcc->prefetch_nrun == 0) {
+        HDmemcpy(rdcc->prefetch_last, scaled, sizeof(hsize_t) * ndims);
+        rdcc->prefetch_nrun = 1;
+    } /* end if */
+    else {
+        for(u = 0; u < ndims; u++) {
+            stride[u] = (hssize_t)scaled[u] - (hssize_t)rdcc->prefetch_last[u];
+            if(stride[u] != 0)
+                moved = TRUE;
+            if(stride[u] != rdcc->prefetch_stride[u])
+                same = FALSE;
+        } /* end for */
+
+        if(moved) {
+            if(same && rdcc->prefetch_nrun > 1)
+                rdcc->prefetch_nrun++;
             else {
-                /* Point I/O info at "nonexistent" I/O info for this chunk */
-                chk_io_info = &nonexistent_io_info;
+                HDmemcpy(rdcc->prefetch_stride, stride, sizeof(hssize_t) * ndims);
+                rdcc->prefetch_nrun = 2;
             } /* end else */
+            HDmemcpy(rdcc->prefetch_last, scaled, sizeof(hsize_t) * ndims);
+        } /* end if */
+    } /* end else */
 
-            /* Perform the actual read operation */
-            if((io_info->io_ops.single_read)(chk_io_info, type_info,
-                    (hsize_t)chunk_info->chunk_points, chunk_info->fspace, chunk_info->mspace) < 0)
-                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_prefetch_note() */
 
-            /* Release the cache lock on the chunk. */
-            if(chunk && H5D__chunk_unlock(io_info, &udata, FALSE, chunk, src_accessed_bytes) < 0)
-                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
-        } /* end if */
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_prefetch_coords
+ *
+ * Purpose:	Computes the scaled coordinates of the Nth chunk after the
+ *		last one read, along the current stride.
+ *
+ * Return:	TRUE if the chunk is within the dataset, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_prefetch_coords(const H5D_t *dset, size_t n, hsize_t *scaled)
+{
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk); /* Raw data chunk cache */
+    unsigned u;                         /* Local index variable */
+    hbool_t ret_value = TRUE;           /* Return value */
 
-        /* Advance to next chunk in list */
-        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
-    } /* end while */
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < dset->shared->ndims; u++) {
+        hssize_t coord = (hssize_t)rdcc->prefetch_last[u] + (hssize_t)n * rdcc->prefetch_stride[u];
+
+        if(coord < 0 || (hsize_t)coord * dset->shared->layout.u.chunk.dim[u] >= dset->shared->curr_dims[u])
+            HGOTO_DONE(FALSE)
+        scaled[u] = (hsize_t)coord;
+    } /* end for */
+
+    /* The datatype dimension's coordinate is always 0 */
+    scaled[dset->shared->ndims] = 0;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__chunk_read() */
+} /* end H5D__chunk_prefetch_coords() */
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_write
+ * Function:	H5D__chunk_prefetch
  *
- * Purpose:	Writes to a chunked dataset.
+ * Purpose:	Reads the chunks that follow the last one read along the
+ *		current stride into the chunk cache, so that the reads that
+ *		continue the access pattern find them there.  Chunks that
+ *		are cached already or don't exist in the file are skipped.
+ *		If more than one thread may run the filters, the chunks are
+ *		unfiltered concurrently first.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_prefetch(H5D_io_info_t *io_info)
+{
+    const H5D_t *dset = io_info->dset;  /* Local pointer to the dataset info */
+    const H5O_pline_t *pline = &(dset->shared->dcpl_cache.pline); /* I/O pipeline info */
+    H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk); /* Raw data chunk cache */
+    hsize_t *saved_scaled = io_info->store->chunk.scaled; /* Coordinates of chunk being read */
+    hsize_t scaled[H5O_LAYOUT_NDIMS];   /* Coordinates of chunk to read ahead */
+    size_t chunk_size;                  /* Size of a chunk */
+    size_t nchunks;                     /* Number of chunks to read ahead */
+    size_t u;                           /* Local index variable */
+    hbool_t stage_chunks = FALSE;       /* Whether to unfilter the chunks concurrently */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(rdcc->prefetch_nchunks > 0);
+    HDassert(rdcc->prefetch_nrun > 2);
+
+    /* Leave room in the cache for the chunk just read */
+    H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+    if(rdcc->nslots == 0 || chunk_size > rdcc->nbytes_max)
+        HGOTO_DONE(SUCCEED)
+    nchunks = MIN(rdcc->prefetch_nchunks, rdcc->nbytes_max / chunk_size - 1);
+
+    /* Read and unfilter the chunks in one batch, if more than one thread may
+     * run the filters (see H5D__chunk_read)
+     */
+    if(io_info->dxpl_cache->filter_nthreads > 1 && pline->nused > 0 && nchunks > 1) {
+        htri_t filters_avail;
+
+        if((filters_avail = H5Z_all_filters_avail(pline)) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't check for available filters")
+        stage_chunks = (hbool_t)filters_avail;
+    } /* end if */
+    if(stage_chunks) {
+        H5D__chunk_stage_discard(rdcc, pline);
+        if(H5D__chunk_stage_reserve(rdcc, nchunks) < 0)
+            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "can't allocate staged chunks")
+        for(u = 1; u <= nchunks && H5D__chunk_prefetch_coords(dset, u, scaled); u++)
+            if(H5D__chunk_stage_one(io_info, scaled) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read ahead raw data chunk")
+        if(rdcc->nstaged > 0)
+            if(H5D__chunk_filter_bufs(pline, H5Z_FLAG_REVERSE, io_info->dxpl_cache->filter_nthreads,
+                    io_info->dxpl_cache, rdcc->staged, rdcc->nstaged) < 0)
+                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "data pipeline read failed")
+    } /* end if */
+
+    /* Bring the chunks into the cache */
+    for(u = 1; u <= nchunks && H5D__chunk_prefetch_coords(dset, u, scaled); u++) {
+        H5D_chunk_ud_t udata;           /* Chunk index pass-through */
+        void *chunk;                    /* Pointer to locked chunk buffer */
+        htri_t cacheable;               /* Whether the chunk is cacheable */
+
+        if(H5D__chunk_lookup(dset, io_info->md_dxpl_id, scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+        if(!H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint)
+            continue;
+
+        io_info->store->chunk.scaled = scaled;
+        if((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, FALSE)) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
+        if(!cacheable)
+            continue;
+
+        rdcc->prefetching = TRUE;
+        if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE, FALSE)))
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read ahead raw data chunk")
+        rdcc->prefetching = FALSE;
+        if(H5D__chunk_unlock(io_info, &udata, FALSE, chunk, (uint32_t)0) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
+    } /* end for */
+
+done:
+    rdcc->prefetching = FALSE;
+    io_info->store->chunk.scaled = saved_scaled;
+    if(stage_chunks)
+        H5D__chunk_stage_discard(rdcc, pline);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_read
+ *
+ * Purpose:	Read from a chunked dataset.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -2353,27 +3877,36 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+H5D__chunk_read(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     hsize_t H5_ATTR_UNUSED nelmts, const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
     H5D_chunk_map_t *fm)
 {
     H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
+    H5D_io_info_t nonexistent_io_info;  /* "nonexistent" I/O info object */
     H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
     H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
     H5D_io_info_t cpt_io_info;          /* Compact I/O info object */
     H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
     hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
-    uint32_t    dst_accessed_bytes = 0; /* Total accessed size in a chunk */
-    herr_t	ret_value = SUCCEED;	/* Return value		*/
+    uint32_t    src_accessed_bytes = 0; /* Total accessed size in a chunk */
+    hbool_t     skip_missing_chunks = FALSE;    /* Whether to skip missing chunks */
+    hbool_t     stage_chunks = FALSE;   /* Whether to unfilter chunks ahead of the read loop */
+    H5SL_node_t *ahead_node = NULL;     /* Next chunk to unfilter ahead of the read loop */
+    H5D_rdcc_t  *rdcc = &(io_info->dset->shared->cache.chunk); /* Raw data chunk cache */
+    herr_t	ret_value = SUCCEED;	/*return value		*/
 
     FUNC_ENTER_STATIC
 
     /* Sanity check */
     HDassert(io_info);
-    HDassert(io_info->u.wbuf);
+    HDassert(io_info->u.rbuf);
     HDassert(type_info);
     HDassert(fm);
 
+    /* Set up "nonexistent" I/O info object */
+    HDmemcpy(&nonexistent_io_info, io_info, sizeof(nonexistent_io_info));
+    nonexistent_io_info.layout_ops = *H5D_LOPS_NONEXISTENT;
+
     /* Set up contiguous I/O info object */
     HDmemcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
     ctg_io_info.store = &ctg_store;
@@ -2390,19 +3923,203 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
     /* Initialize temporary compact storage info */
     cpt_store.compact.dirty = &cpt_dirty;
 
+    {
+        const H5O_fill_t *fill = &(io_info->dset->shared->dcpl_cache.fill);    /* Fill value info */
+        H5D_fill_value_t fill_status;       /* Fill value status */
+
+        /* Check the fill value status */
+        if(H5P_is_fill_value_defined(fill, &fill_status) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't tell if fill value defined")
+
+        /* If we are never to return fill values, or if we would return them
+         * but they aren't set, set the flag to skip missing chunks.
+         */
+        if(fill->fill_time == H5D_FILL_TIME_NEVER ||
+                (fill->fill_time == H5D_FILL_TIME_IFSET &&
+                 fill_status != H5D_FILL_VALUE_USER_DEFINED &&
+                 fill_status != H5D_FILL_VALUE_DEFAULT))
+            skip_missing_chunks = TRUE;
+    }
+
+    /* If more than one thread may run the filters, read and unfilter the
+     * chunks in batches before the loop below needs them.  The filters must
+     * all be registered already, the pipeline can't load plugins from the
+     * worker threads.
+     */
+    if(io_info->dxpl_cache->filter_nthreads > 1 && !fm->use_single
+            && io_info->dset->shared->dcpl_cache.pline.nused > 0) {
+        htri_t filters_avail;
+
+        if((filters_avail = H5Z_all_filters_avail(&(io_info->dset->shared->dcpl_cache.pline))) < 0)
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTGET, FAIL, "can't check for available filters")
+        stage_chunks = (hbool_t)filters_avail;
+    } /* end if */
+
     /* Iterate through nodes in chunk skip list */
     chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
+    ahead_node = chunk_node;
     while(chunk_node) {
         H5D_chunk_info_t *chunk_info;   /* Chunk information */
-	H5D_chk_idx_info_t idx_info;    /* Chunked index info */
-        H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
-        void *chunk;                    /* Pointer to locked chunk buffer */
-        H5D_chunk_ud_t udata;		/* Index pass-through	*/
-        htri_t cacheable;               /* Whether the chunk is cacheable */
-        hbool_t need_insert = FALSE;    /* Whether the chunk needs to be inserted into the index */
+        H5D_chunk_ud_t udata;		/* Chunk index pass-through	*/
+
+        /* Unfilter the next batch of chunks, once the last one is used up */
+        if(stage_chunks && chunk_node == ahead_node)
+            if(H5D__chunk_stage_filtered(io_info, fm, &ahead_node) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read ahead raw data chunks")
+
+        /* Get the actual chunk information from the skip list node */
+        if(NULL == (chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't get chunk information")
+
+        /* Track the access pattern, for reading ahead */
+        if(rdcc->prefetch_nchunks > 0)
+            H5D__chunk_prefetch_note(rdcc, io_info->dset->shared->ndims, chunk_info->scaled);
+
+        /* Get the info for the chunk in the file */
+        if(H5D__chunk_lookup(io_info->dset, io_info->md_dxpl_id, chunk_info->scaled, &udata) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "error looking up chunk address")
+
+        /* Sanity check */
+        HDassert((H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length > 0) || 
+                (!H5F_addr_defined(udata.chunk_block.offset) && udata.chunk_block.length == 0));
+
+        /* Check for non-existant chunk & skip it if appropriate */
+        if(H5F_addr_defined(udata.chunk_block.offset) || UINT_MAX != udata.idx_hint
+                || !skip_missing_chunks) {
+            H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
+            void *chunk = NULL;             /* Pointer to locked chunk buffer */
+            htri_t cacheable;               /* Whether the chunk is cacheable */
+
+            /* Set chunk's [scaled] coordinates */
+            io_info->store->chunk.scaled = chunk_info->scaled;
+
+            /* Determine if we should use the chunk cache */
+            if((cacheable = H5D__chunk_cacheable(io_info, udata.chunk_block.offset, FALSE)) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't tell if chunk is cacheable")
+            if(cacheable) {
+                /* Load the chunk into cache and lock it. */
+
+                /* Compute # of bytes accessed in chunk */
+                H5_CHECK_OVERFLOW(type_info->src_type_size, /*From:*/ size_t, /*To:*/ uint32_t);
+                src_accessed_bytes = chunk_info->chunk_points * (uint32_t)type_info->src_type_size;
+
+                /* Lock the chunk into the cache */
+                if(NULL == (chunk = H5D__chunk_lock(io_info, &udata, FALSE, FALSE)))
+                    HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read raw data chunk")
+
+                /* Set up the storage buffer information for this chunk */
+                cpt_store.compact.buf = chunk;
+
+                /* Point I/O info at contiguous I/O info for this chunk */
+                chk_io_info = &cpt_io_info;
+            } /* end if */
+            else if(H5F_addr_defined(udata.chunk_block.offset)) {
+                /* Set up the storage address information for this chunk */
+                ctg_store.contig.dset_addr = udata.chunk_block.offset;
+
+                /* Point I/O info at temporary I/O info for this chunk */
+                chk_io_info = &ctg_io_info;
+            } /* end else if */
+            else {
+                /* Point I/O info at "nonexistent" I/O info for this chunk */
+                chk_io_info = &nonexistent_io_info;
+            } /* end else */
+
+            /* Perform the actual read operation */
+            if((io_info->io_ops.single_read)(chk_io_info, type_info,
+                    (hsize_t)chunk_info->chunk_points, chunk_info->fspace, chunk_info->mspace) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunked read failed")
+
+            /* Release the cache lock on the chunk. */
+            if(chunk && H5D__chunk_unlock(io_info, &udata, FALSE, chunk, src_accessed_bytes) < 0)
+                HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to unlock raw data chunk")
+        } /* end if */
+
+        /* Advance to next chunk in list */
+        chunk_node = H5D_CHUNK_GET_NEXT_NODE(fm, chunk_node);
+    } /* end while */
+
+    /* Read the next chunks ahead, if the reads follow a constant stride */
+    if(rdcc->prefetch_nchunks > 0 && rdcc->prefetch_nrun > 2) {
+        if(stage_chunks)
+            H5D__chunk_stage_discard(rdcc, &(io_info->dset->shared->dcpl_cache.pline));
+        if(H5D__chunk_prefetch(io_info) < 0)
+            HGOTO_ERROR(H5E_IO, H5E_READERROR, FAIL, "unable to read ahead raw data chunks")
+    } /* end if */
+
+done:
+    /* Release any chunks read ahead but not used */
+    if(stage_chunks)
+        H5D__chunk_stage_discard(&(io_info->dset->shared->cache.chunk), &(io_info->dset->shared->dcpl_cache.pline));
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_read() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_write
+ *
+ * Purpose:	Writes to a chunked dataset.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Raymond Lu
+ *		Thursday, April 10, 2003
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
+    hsize_t H5_ATTR_UNUSED nelmts, const H5S_t H5_ATTR_UNUSED *file_space, const H5S_t H5_ATTR_UNUSED *mem_space,
+    H5D_chunk_map_t *fm)
+{
+    H5SL_node_t *chunk_node;            /* Current node in chunk skip list */
+    H5D_io_info_t ctg_io_info;          /* Contiguous I/O info object */
+    H5D_storage_t ctg_store;            /* Chunk storage information as contiguous dataset */
+    H5D_io_info_t cpt_io_info;          /* Compact I/O info object */
+    H5D_storage_t cpt_store;            /* Chunk storage information as compact dataset */
+    hbool_t     cpt_dirty;              /* Temporary placeholder for compact storage "dirty" flag */
+    uint32_t    dst_accessed_bytes = 0; /* Total accessed size in a chunk */
+    herr_t	ret_value = SUCCEED;	/* Return value		*/
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity check */
+    HDassert(io_info);
+    HDassert(io_info->u.wbuf);
+    HDassert(type_info);
+    HDassert(fm);
+
+    /* Set up contiguous I/O info object */
+    HDmemcpy(&ctg_io_info, io_info, sizeof(ctg_io_info));
+    ctg_io_info.store = &ctg_store;
+    ctg_io_info.layout_ops = *H5D_LOPS_CONTIG;
+
+    /* Initialize temporary contiguous storage info */
+    H5_CHECKED_ASSIGN(ctg_store.contig.dset_size, hsize_t, io_info->dset->shared->layout.u.chunk.size, uint32_t);
+
+    /* Set up compact I/O info object */
+    HDmemcpy(&cpt_io_info, io_info, sizeof(cpt_io_info));
+    cpt_io_info.store = &cpt_store;
+    cpt_io_info.layout_ops = *H5D_LOPS_COMPACT;
+
+    /* Initialize temporary compact storage info */
+    cpt_store.compact.dirty = &cpt_dirty;
+
+    /* Iterate through nodes in chunk skip list */
+    chunk_node = H5D_CHUNK_GET_FIRST_NODE(fm);
+    while(chunk_node) {
+        H5D_chunk_info_t *chunk_info;   /* Chunk information */
+	H5D_chk_idx_info_t idx_info;    /* Chunked index info */
+        H5D_io_info_t *chk_io_info;     /* Pointer to I/O info object for this chunk */
+        void *chunk;                    /* Pointer to locked chunk buffer */
+        H5D_chunk_ud_t udata;		/* Index pass-through	*/
+        htri_t cacheable;               /* Whether the chunk is cacheable */
+        hbool_t need_insert = FALSE;    /* Whether the chunk needs to be inserted into the index */
 
         /* Get the actual chunk information from the skip list node */
-        chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node);
+        if(NULL == (chunk_info = H5D_CHUNK_GET_NODE_INFO(fm, chunk_node)))
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL, "can't get chunk information")
 
         /* Look up the chunk */
         if(H5D__chunk_lookup(io_info->dset, io_info->md_dxpl_id, chunk_info->scaled, &udata) < 0)
@@ -2465,7 +4182,7 @@ H5D__chunk_write(H5D_io_info_t *io_info, const H5D_type_info_t *type_info,
                     HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "chunk address isn't defined")
 
                 /* Cache the new chunk information */
-                H5D__chunk_cinfo_cache_update(&io_info->dset->shared->cache.chunk.last, &udata);
+                H5D__chunk_cinfo_cache_update(&io_info->dset->shared->cache.chunk, &udata);
             } /* end if */
 
             /* Set up the storage address information for this chunk */
@@ -2536,11 +4253,18 @@ H5D__chunk_flush(H5D_t *dset, hid_t dxpl_id)
         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
 
     /* Loop over all entries in the chunk cache */
-    for(ent = rdcc->head; ent; ent = next) {
-	next = ent->next;
-        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE) < 0)
-            nerrors++;
-    } /* end for */
+    if(rdcc->filter_nthreads > 1 && dset->shared->dcpl_cache.pline.nused > 0) {
+        /* Write the chunks back in batches, filtering them concurrently */
+        for(ent = rdcc->head; ent; )
+            if(H5D__chunk_flush_batch(dset, dxpl_id, dxpl_cache, &ent, FALSE) < 0)
+                nerrors++;
+    } /* end if */
+    else
+        for(ent = rdcc->head; ent; ent = next) {
+            next = ent->next;
+            if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE, NULL) < 0)
+                nerrors++;
+        } /* end for */
     if(nerrors)
 	HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
 
@@ -2579,6 +4303,14 @@ H5D__chunk_io_term(const H5D_chunk_map_t *fm)
         /* Reset the selection for the single element I/O */
         H5S_select_all(fm->single_space, TRUE);
     } /* end if */
+    else if(fm->use_regular) {
+        /* Sanity checks */
+        HDassert(fm->sel_chunks == NULL);
+
+        /* Reset the selection of the shared chunk dataspace */
+        if(fm->single_space)
+            H5S_select_all(fm->single_space, TRUE);
+    } /* end if */
     else {
         /* Release the nodes on the list of selected chunks */
         if(fm->sel_chunks)
@@ -2636,6 +4368,12 @@ H5D__chunk_dest(H5D_t *dset, hid_t dxpl_id)
         nerrors++;
 
     /* Flush all the cached chunks */
+    if(rdcc->filter_nthreads > 1 && dset->shared->dcpl_cache.pline.nused > 0) {
+        /* Write the chunks back in batches, filtering them concurrently */
+        for(ent = rdcc->head; ent; )
+            if(H5D__chunk_flush_batch(dset, dxpl_id, dxpl_cache, &ent, TRUE) < 0)
+                nerrors++;
+    } /* end if */
     for(ent = rdcc->head; ent; ent = next) {
         next = ent->next;
         if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, ent, TRUE) < 0)
@@ -2649,6 +4387,16 @@ H5D__chunk_dest(H5D_t *dset, hid_t dxpl_id)
     /* Release cache structures */
     if(rdcc->slot)
         rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
+    if(rdcc->ghost)
+        rdcc->ghost = (hsize_t *)H5MM_xfree(rdcc->ghost);
+    if(rdcc->ghost_slot)
+        rdcc->ghost_slot = (size_t *)H5MM_xfree(rdcc->ghost_slot);
+    if(rdcc->cinfo)
+        rdcc->cinfo = (H5D_chunk_cinfo_ent_t *)H5MM_xfree(rdcc->cinfo);
+    if(rdcc->staged) {
+        H5D__chunk_stage_discard(rdcc, &(dset->shared->dcpl_cache.pline));
+        rdcc->staged = (H5D_chunk_filt_t *)H5MM_xfree(rdcc->staged);
+    } /* end if */
     HDmemset(rdcc, 0, sizeof(H5D_rdcc_t));
 
     /* Compose chunked index info struct */
@@ -2704,7 +4452,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_cinfo_cache_reset
  *
- * Purpose:	Reset the cached chunk info
+ * Purpose:	Reset the cached chunk info, including the chunk address
+ *		cache
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -2713,25 +4462,94 @@ done:
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5D__chunk_cinfo_cache_reset(H5D_chunk_cached_t *last)
+herr_t
+H5D__chunk_cinfo_cache_reset(H5D_rdcc_t *rdcc)
 {
     FUNC_ENTER_PACKAGE_NOERR
 
     /* Sanity check */
-    HDassert(last);
+    HDassert(rdcc);
 
     /* Indicate that the cached info is not valid */
-    last->valid = FALSE;
+    rdcc->last.valid = FALSE;
+
+    /* Empty the address cache */
+    if(rdcc->cinfo_nused > 0) {
+        HDmemset(rdcc->cinfo, 0, rdcc->cinfo_nalloc * sizeof(H5D_chunk_cinfo_ent_t));
+        rdcc->cinfo_nused = 0;
+    } /* end if */
 
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* H5D__chunk_cinfo_cache_reset() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cinfo_hash_val
+ *
+ * Purpose:	To calculate the entry in the chunk address cache for a
+ *		chunk, from its linear index in the dataset.  The index is
+ *		scrambled by Fibonacci hashing, as for the chunk cache, so
+ *		that strided access patterns don't collide.
+ *
+ * Return:	Index of entry
+ *
+ *-------------------------------------------------------------------------
+ */
+static size_t
+H5D__chunk_cinfo_hash_val(const H5D_rdcc_t *rdcc, hsize_t key)
+{
+    uint32_t hash;      /* Scrambled value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Multiply by 2^32 / golden ratio and keep the high bits */
+    hash = (uint32_t)(key ^ (key >> 32)) * (uint32_t)2654435769U;
+
+    FUNC_LEAVE_NOAPI((size_t)(hash >> (32 - rdcc->cinfo_nbits)))
+} /* H5D__chunk_cinfo_hash_val() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cinfo_key
+ *
+ * Purpose:	To calculate the key of a chunk in the chunk address cache,
+ *		its linear index in the dataset plus one.  Chunks outside
+ *		the dataset's current extent (only looked up while it
+ *		shrinks) have no linear index of their own and get no key.
+ *
+ * Return:	Key of chunk, or 0 if it can't be cached
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5D__chunk_cinfo_key(const H5O_layout_chunk_t *layout, const hsize_t *scaled)
+{
+    unsigned u;                 /* Local index variable */
+    hsize_t ret_value = 0;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    for(u = 0; u < layout->ndims - 1; u++)
+        if(scaled[u] >= layout->chunks[u])
+            HGOTO_DONE(0)
+
+    ret_value = H5VM_array_offset_pre(layout->ndims - 1, layout->down_chunks, scaled) + 1;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_cinfo_key() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_cinfo_cache_update
  *
- * Purpose:	Update the cached chunk info
+ * Purpose:	Update the cached chunk info.  Chunks that exist are also
+ *		entered in the chunk address cache, which is allocated on
+ *		first use and grows while more than half of its entries are
+ *		in use, up to its memory limit.  Entries are replaced when
+ *		another chunk maps to them.  Since the address cache is
+ *		only an optimization, running out of memory for it isn't
+ *		an error.
  *
  * Return:	Non-negative on success/Negative on failure
  *
@@ -2741,12 +4559,17 @@ H5D__chunk_cinfo_cache_reset(H5D_chunk_cached_t *last)
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last, const H5D_chunk_ud_t *udata)
+H5D__chunk_cinfo_cache_update(H5D_rdcc_t *rdcc, const H5D_chunk_ud_t *udata)
 {
+    H5D_chunk_cached_t *last = &rdcc->last;   /* Last chunk looked up */
+    H5D_chunk_cinfo_ent_t *ent;         /* Address cache entry */
+    hsize_t key;                        /* Key of chunk in address cache */
+    herr_t ret_value = SUCCEED;         /* Return value */
+
     FUNC_ENTER_STATIC_NOERR
 
     /* Sanity check */
-    HDassert(last);
+    HDassert(rdcc);
     HDassert(udata);
     HDassert(udata->common.layout);
     HDassert(udata->common.scaled);
@@ -2761,14 +4584,75 @@ H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last, const H5D_chunk_ud_t *ud
     /* Indicate that the cached info is valid */
     last->valid = TRUE;
 
-    FUNC_LEAVE_NOAPI(SUCCEED)
+    /* Check if the address cache is enabled */
+    if(rdcc->cinfo_nbytes_max < H5D_CINFO_NALLOC_MIN * sizeof(H5D_chunk_cinfo_ent_t))
+        HGOTO_DONE(SUCCEED)
+
+    if(0 == (key = H5D__chunk_cinfo_key(udata->common.layout, udata->common.scaled)))
+        HGOTO_DONE(SUCCEED)
+
+    /* Chunks that don't exist aren't cached, but may have to be forgotten */
+    if(!H5F_addr_defined(udata->chunk_block.offset)) {
+        if(rdcc->cinfo_nused > 0) {
+            ent = &rdcc->cinfo[H5D__chunk_cinfo_hash_val(rdcc, key)];
+            if(ent->key == key) {
+                ent->key = 0;
+                rdcc->cinfo_nused--;
+            } /* end if */
+        } /* end if */
+        HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Allocate the address cache, or grow it while it's more than half full */
+    if(NULL == rdcc->cinfo || (rdcc->cinfo_nused * 2 > rdcc->cinfo_nalloc
+            && rdcc->cinfo_nalloc * 2 * sizeof(H5D_chunk_cinfo_ent_t) <= rdcc->cinfo_nbytes_max)) {
+        H5D_chunk_cinfo_ent_t *new_cinfo;   /* New table */
+        size_t new_nalloc = rdcc->cinfo ? rdcc->cinfo_nalloc * 2 : H5D_CINFO_NALLOC_MIN;  /* New table size */
+
+        if(NULL != (new_cinfo = (H5D_chunk_cinfo_ent_t *)H5MM_calloc(new_nalloc * sizeof(H5D_chunk_cinfo_ent_t)))) {
+            H5D_chunk_cinfo_ent_t *old_cinfo = rdcc->cinfo;   /* Previous table */
+            size_t old_nalloc = rdcc->cinfo_nalloc;     /* Previous table size */
+            size_t u;                   /* Local index variable */
+
+            rdcc->cinfo = new_cinfo;
+            rdcc->cinfo_nalloc = new_nalloc;
+            rdcc->cinfo_nbits = H5VM_log2_gen((uint64_t)new_nalloc);
+
+            /* Move the entries over, those that map to the same entry now are dropped */
+            rdcc->cinfo_nused = 0;
+            for(u = 0; u < old_nalloc; u++)
+                if(old_cinfo[u].key) {
+                    ent = &rdcc->cinfo[H5D__chunk_cinfo_hash_val(rdcc, old_cinfo[u].key)];
+                    if(0 == ent->key)
+                        rdcc->cinfo_nused++;
+                    *ent = old_cinfo[u];
+                } /* end if */
+            H5MM_xfree(old_cinfo);
+        } /* end if */
+        else if(NULL == rdcc->cinfo)
+            HGOTO_DONE(SUCCEED)
+    } /* end if */
+
+    /* Store the chunk's location, replacing any other chunk */
+    ent = &rdcc->cinfo[H5D__chunk_cinfo_hash_val(rdcc, key)];
+    if(0 == ent->key)
+        rdcc->cinfo_nused++;
+    ent->key = key;
+    ent->addr = udata->chunk_block.offset;
+    ent->nbytes = last->nbytes;
+    ent->chunk_idx = udata->chunk_idx;
+    ent->filter_mask = udata->filter_mask;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
 } /* H5D__chunk_cinfo_cache_update() */
 
 
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_cinfo_cache_found
  *
- * Purpose:	Look for chunk info in cache
+ * Purpose:	Look for chunk info in cache, first for the last chunk
+ *		looked up, then in the chunk address cache
  *
  * Return:	TRUE/FALSE/FAIL
  *
@@ -2778,14 +4662,15 @@ H5D__chunk_cinfo_cache_update(H5D_chunk_cached_t *last, const H5D_chunk_ud_t *ud
  *-------------------------------------------------------------------------
  */
 static hbool_t
-H5D__chunk_cinfo_cache_found(const H5D_chunk_cached_t *last, H5D_chunk_ud_t *udata)
+H5D__chunk_cinfo_cache_found(H5D_rdcc_t *rdcc, H5D_chunk_ud_t *udata)
 {
+    const H5D_chunk_cached_t *last = &rdcc->last;   /* Last chunk looked up */
     hbool_t ret_value = FALSE;          /* Return value */
 
     FUNC_ENTER_STATIC_NOERR
 
     /* Sanity check */
-    HDassert(last);
+    HDassert(rdcc);
     HDassert(udata);
     HDassert(udata->common.layout);
     HDassert(udata->common.scaled);
@@ -2797,17 +4682,39 @@ H5D__chunk_cinfo_cache_found(const H5D_chunk_cached_t *last, H5D_chunk_ud_t *uda
         /* Check that the scaled offset is the same */
         for(u = 0; u < udata->common.layout->ndims; u++)
             if(last->scaled[u] != udata->common.scaled[u])
-                HGOTO_DONE(FALSE)
+                break;
 
-        /* Retrieve the information from the cache */
-        udata->chunk_block.offset = last->addr;
-        udata->chunk_block.length = last->nbytes;
-        udata->chunk_idx = last->chunk_idx;
-        udata->filter_mask = last->filter_mask;
+        if(u == udata->common.layout->ndims) {
+            /* Retrieve the information from the cache */
+            udata->chunk_block.offset = last->addr;
+            udata->chunk_block.length = last->nbytes;
+            udata->chunk_idx = last->chunk_idx;
+            udata->filter_mask = last->filter_mask;
+
+            /* Indicate that the data was found */
+            HGOTO_DONE(TRUE)
+        } /* end if */
+    } /* end if */
 
-        /* Indicate that the data was found */
-        HGOTO_DONE(TRUE)
+    /* Check the address cache */
+    if(rdcc->cinfo_nused > 0) {
+        const H5D_chunk_cinfo_ent_t *ent;   /* Address cache entry */
+        hsize_t key;                        /* Key of chunk in address cache */
+
+        key = H5D__chunk_cinfo_key(udata->common.layout, udata->common.scaled);
+        ent = &rdcc->cinfo[H5D__chunk_cinfo_hash_val(rdcc, key)];
+        if(key && ent->key == key) {
+            udata->chunk_block.offset = ent->addr;
+            udata->chunk_block.length = ent->nbytes;
+            udata->chunk_idx = ent->chunk_idx;
+            udata->filter_mask = ent->filter_mask;
+            rdcc->stats.ncinfo_hits++;
+
+            HGOTO_DONE(TRUE)
+        } /* end if */
     } /* end if */
+    if(rdcc->cinfo_nbytes_max > 0)
+        rdcc->stats.ncinfo_misses++;
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -2872,8 +4779,15 @@ done:
 /*-------------------------------------------------------------------------
  * Function:	H5D__chunk_hash_val
  *
- * Purpose:	To calculate an index based on the dataset's scaled coordinates and
- *		sizes of the faster dimensions.
+ * Purpose:	To calculate the home slot in a hash table of 2^NBITS
+ *		slots for a chunk, based on the dataset's scaled
+ *		coordinates and sizes of the faster dimensions.  The chunk
+ *		cache and the 2Q ghosts are both keyed this way.
+ *
+ *		The scaled coordinates are packed into a single value (the
+ *		fastest dimension in the low bits), which is then scrambled
+ *		by Fibonacci hashing so that strided access patterns don't
+ *		cluster in the table.
  *
  * Return:	Hash value index
  *
@@ -2882,10 +4796,12 @@ done:
  *-------------------------------------------------------------------------
  */
 static unsigned
-H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
+H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled, unsigned nbits)
 {
     hsize_t val;        /* Intermediate value */
+    uint32_t hash;      /* Scrambled value */
     unsigned ndims = shared->ndims;      /* Rank of dataset */
+    unsigned u;         /* Local index variable */
     unsigned ret = 0;   /* Value to return */
 
     FUNC_ENTER_STATIC_NOERR
@@ -2893,91 +4809,208 @@ H5D__chunk_hash_val(const H5D_shared_t *shared, const hsize_t *scaled)
     /* Sanity check */
     HDassert(shared);
     HDassert(scaled);
+    HDassert(nbits > 0 && nbits <= 32);
 
-    /* If the fastest changing dimension doesn't have enough entropy, use
-     *  other dimensions too
-     */
-    if(ndims > 1 && shared->cache.chunk.scaled_dims[ndims - 1] <= shared->cache.chunk.nslots) {
-        unsigned u;          /* Local index variable */
-
-        val = scaled[0];
-        for(u = 1; u < ndims; u++) {
-            val <<= shared->cache.chunk.scaled_encode_bits[u];
-            val ^= scaled[u];
-        } /* end for */
-    } /* end if */
-    else
-        val = scaled[ndims - 1];
+    val = scaled[0];
+    for(u = 1; u < ndims; u++) {
+        val <<= shared->cache.chunk.scaled_encode_bits[u];
+        val ^= scaled[u];
+    } /* end for */
 
-    /* Modulo value against the number of array slots */
-    ret = (unsigned)(val % shared->cache.chunk.nslots);
+    /* Multiply by 2^32 / golden ratio and keep the high bits */
+    hash = (uint32_t)(val ^ (val >> 32)) * (uint32_t)2654435769U;
+    ret = (unsigned)(hash >> (32 - nbits));
 
     FUNC_LEAVE_NOAPI(ret)
 } /* H5D__chunk_hash_val() */
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_lookup
- *
- * Purpose:	Loops up a chunk in cache and on disk, and retrieves
- *              information about that chunk.
+ * Function:	H5D__chunk_cache_find
  *
- * Return:	Non-negative on success/Negative on failure
+ * Purpose:	Look up a chunk in the chunk cache hash table, probing
+ *		from its home slot until the chunk or an empty slot is
+ *		found.
  *
- * Programmer:	Albert Cheng
- *              June 27, 1998
+ * Return:	Index of the chunk's slot, or UINT_MAX if the chunk isn't
+ *		cached
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id, const hsize_t *scaled,
-    H5D_chunk_ud_t *udata)
+static unsigned
+H5D__chunk_cache_find(const H5D_shared_t *shared, const hsize_t *scaled)
 {
-    H5D_rdcc_ent_t  *ent = NULL;        /* Cache entry */
-    H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
-    unsigned idx;                       /* Index of chunk in cache, if present */
-    hbool_t found = FALSE;              /* In cache? */
-    herr_t ret_value = SUCCEED;	        /* Return value */
+    const H5D_rdcc_t *rdcc = &(shared->cache.chunk);   /* Chunk cache */
+    H5D_rdcc_ent_t *ent;        /* Entry in slot */
+    unsigned    idx;            /* Slot index */
+    unsigned    ret_value = UINT_MAX;   /* Return value */
 
-    FUNC_ENTER_PACKAGE
+    FUNC_ENTER_STATIC_NOERR
 
     /* Sanity checks */
-    HDassert(dset);
-    HDassert(dset->shared->layout.u.chunk.ndims > 0);
-    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+    HDassert(rdcc->slot);
     HDassert(scaled);
-    HDassert(udata);
-
-    /* Initialize the query information about the chunk we are looking for */
-    udata->common.layout = &(dset->shared->layout.u.chunk);
-    udata->common.storage = &(dset->shared->layout.storage.u.chunk);
-    udata->common.scaled = scaled;
-
-    /* Reset information about the chunk we are looking for */
-    udata->chunk_block.offset = HADDR_UNDEF;
-    udata->chunk_block.length = 0;
-    udata->filter_mask = 0;
-    udata->new_unfilt_chunk = FALSE;
 
-    /* Check for chunk in cache */
-    if(dset->shared->cache.chunk.nslots > 0) {
-        /* Determine the chunk's location in the hash table */
-        idx = H5D__chunk_hash_val(dset->shared, scaled);
+    /* The table always has empty slots, so the probe terminates */
+    for(idx = H5D__chunk_hash_val(shared, scaled, rdcc->slot_nbits); NULL != (ent = rdcc->slot[idx]); idx = (unsigned)((idx + 1) & (rdcc->slot_nalloc - 1)))
+        if(ent != H5D_RDCC_SLOT_DELETED && !HDmemcmp(ent->scaled, scaled, shared->ndims * sizeof(hsize_t)))
+            HGOTO_DONE(idx)
 
-        /* Get the chunk cache entry for that location */
-        ent = dset->shared->cache.chunk.slot[idx];
-        if(ent) {
-            unsigned u;                  /* Counter */
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_cache_find() */
 
-            /* Speculatively set the 'found' flag */
-            found = TRUE;
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_rehash
+ *
+ * Purpose:	Rebuild the chunk cache hash table with NALLOC slots (a
+ *		power of two), reinserting every cached chunk and dropping
+ *		the deleted slot markers.  Locked entries move too, so the
+ *		index hints held for them become stale (see
+ *		H5D__chunk_unlock).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_rehash(H5D_shared_t *shared, size_t nalloc)
+{
+    H5D_rdcc_t *rdcc = &(shared->cache.chunk);  /* Chunk cache */
+    H5D_rdcc_ent_t **slot;      /* New hash table */
+    H5D_rdcc_ent_t *ent;        /* Cache entry */
+    herr_t      ret_value = SUCCEED;    /* Return value */
 
-            /* Verify that the cache entry is the correct chunk */
-            for(u = 0; u < dset->shared->ndims; u++)
-                if(scaled[u] != ent->scaled[u]) {
-                    found = FALSE;
-                    break;
-                } /* end if */
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(POWER_OF_TWO(nalloc));
+    HDassert(nalloc > (size_t)rdcc->nused);
+
+    if(NULL == (slot = H5FL_SEQ_CALLOC(H5D_rdcc_ent_ptr_t, nalloc)))
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk cache hash table")
+    rdcc->slot = H5FL_SEQ_FREE(H5D_rdcc_ent_ptr_t, rdcc->slot);
+    rdcc->slot = slot;
+    rdcc->slot_nalloc = nalloc;
+    rdcc->slot_nbits = H5VM_log2_gen((uint64_t)nalloc);
+    rdcc->slot_ndeleted = 0;
+
+    /* Reinsert every entry */
+    for(ent = rdcc->head; ent; ent = ent->next) {
+        unsigned idx;           /* Slot index */
+
+        for(idx = H5D__chunk_hash_val(shared, ent->scaled, rdcc->slot_nbits); rdcc->slot[idx]; idx = (unsigned)((idx + 1) & (nalloc - 1)))
+            ;
+        rdcc->slot[idx] = ent;
+        ent->idx = idx;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_cache_rehash() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_insert
+ *
+ * Purpose:	Insert a new entry for a chunk that isn't cached into the
+ *		chunk cache hash table, growing the table first to keep it
+ *		at most half full (counting deleted slots).
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_insert(H5D_shared_t *shared, H5D_rdcc_ent_t *ent)
+{
+    H5D_rdcc_t *rdcc = &(shared->cache.chunk);  /* Chunk cache */
+    unsigned    idx;            /* Slot index */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(ent);
+    HDassert(UINT_MAX == H5D__chunk_cache_find(shared, ent->scaled));
+
+    /* Rebuild the table when it would be more than half full.  The new size
+     * leaves room for the cache to double before the next rebuild (it may
+     * shrink back if most slots were deleted ones).
+     */
+    if(2 * ((size_t)rdcc->nused + rdcc->slot_ndeleted + 1) > rdcc->slot_nalloc) {
+        size_t nalloc = H5D_RDCC_SLOTS_MIN;     /* New table size */
+
+        while(nalloc < 4 * ((size_t)rdcc->nused + 1))
+            nalloc *= 2;
+        if(H5D__chunk_cache_rehash(shared, nalloc) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTRESIZE, FAIL, "unable to resize chunk cache hash table")
+    } /* end if */
+
+    /* Take the first empty or deleted slot from the chunk's home slot */
+    for(idx = H5D__chunk_hash_val(shared, ent->scaled, rdcc->slot_nbits); rdcc->slot[idx] && rdcc->slot[idx] != H5D_RDCC_SLOT_DELETED; idx = (unsigned)((idx + 1) & (rdcc->slot_nalloc - 1)))
+        ;
+    if(rdcc->slot[idx] == H5D_RDCC_SLOT_DELETED)
+        rdcc->slot_ndeleted--;
+    rdcc->slot[idx] = ent;
+    ent->idx = idx;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_cache_insert() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_lookup
+ *
+ * Purpose:	Loops up a chunk in cache and on disk, and retrieves
+ *              information about that chunk.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Albert Cheng
+ *              June 27, 1998
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id, const hsize_t *scaled,
+    H5D_chunk_ud_t *udata)
+{
+    H5D_rdcc_ent_t  *ent = NULL;        /* Cache entry */
+    H5O_storage_chunk_t *sc = &(dset->shared->layout.storage.u.chunk);
+    unsigned idx;                       /* Index of chunk in cache, if present */
+    hbool_t found = FALSE;              /* In cache? */
+    herr_t ret_value = SUCCEED;	        /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(dset->shared->layout.u.chunk.ndims > 0);
+    H5D_CHUNK_STORAGE_INDEX_CHK(sc);
+    HDassert(scaled);
+    HDassert(udata);
+
+    /* Initialize the query information about the chunk we are looking for */
+    udata->common.layout = &(dset->shared->layout.u.chunk);
+    udata->common.storage = &(dset->shared->layout.storage.u.chunk);
+    udata->common.scaled = scaled;
+
+    /* Reset information about the chunk we are looking for */
+    udata->chunk_block.offset = HADDR_UNDEF;
+    udata->chunk_block.length = 0;
+    udata->filter_mask = 0;
+    udata->new_unfilt_chunk = FALSE;
+
+    /* Check for chunk in cache */
+    if(dset->shared->cache.chunk.nslots > 0) {
+        /* Determine the chunk's location in the hash table */
+        idx = H5D__chunk_cache_find(dset->shared, scaled);
+        if(UINT_MAX != idx) {
+            ent = dset->shared->cache.chunk.slot[idx];
+            found = TRUE;
         } /* end if */
     } /* end if */
 
@@ -2993,7 +5026,7 @@ H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id, const hsize_t *scaled,
         udata->idx_hint = UINT_MAX;
 
         /* Check for cached information */
-        if(!H5D__chunk_cinfo_cache_found(&dset->shared->cache.chunk.last, udata)) {
+        if(!H5D__chunk_cinfo_cache_found(&dset->shared->cache.chunk, udata)) {
             H5D_chk_idx_info_t idx_info;        /* Chunked index info */
 #ifdef H5_HAVE_PARALLEL
             H5P_coll_md_read_flag_t temp_cmr;   /* Temp value to hold the coll metadata read setting */
@@ -3027,7 +5060,7 @@ H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id, const hsize_t *scaled,
 #endif /* H5_HAVE_PARALLEL */
 
             /* Cache the information retrieved */
-            H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, udata);
+            H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk, udata);
         } /* end if */
     } /* end else */
 
@@ -3044,6 +5077,10 @@ done:
  *		the RESET flag is turned on because it results in one fewer
  *		memory copy.
  *
+ *		If FILT is not NULL, it holds a copy of the chunk that was
+ *		already passed through the filter pipeline (see
+ *		H5D__chunk_flush_batch), which is written instead and freed.
+ *
  * Return:	Non-negative on success/Negative on failure
  *
  * Programmer:	Robb Matzke
@@ -3053,7 +5090,7 @@ done:
  */
 static herr_t
 H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t *dxpl_cache,
-    H5D_rdcc_ent_t *ent, hbool_t reset)
+    H5D_rdcc_ent_t *ent, hbool_t reset, H5D_chunk_filt_t *filt)
 {
     void	*buf = NULL;	        /* Temporary buffer		*/
     hbool_t	point_of_no_return = FALSE;
@@ -3068,6 +5105,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
     HDassert(dxpl_cache);
     HDassert(ent);
     HDassert(!ent->locked);
+    HDassert(!filt || filt->ent == ent);
 
     buf = ent->chunk;
     if(ent->dirty) {
@@ -3091,31 +5129,40 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
             size_t alloc = udata.chunk_block.length;        /* Bytes allocated for BUF	*/
             size_t nbytes;                      /* Chunk size (in bytes) */
 
-            if(!reset) {
-                /*
-                 * Copy the chunk to a new buffer before running it through
-                 * the pipeline because we'll want to save the original buffer
-                 * for later.
-                 */
-                if(NULL == (buf = H5MM_malloc(alloc)))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
-                HDmemcpy(buf, ent->chunk, alloc);
+            if(filt) {
+                /* The filters already ran on a copy of the chunk */
+                buf = filt->buf;
+                filt->buf = NULL;
+                nbytes = filt->nbytes;
+                udata.filter_mask = filt->filter_mask;
             } /* end if */
             else {
-                /*
-                 * If we are reseting and something goes wrong after this
-                 * point then it's too late to recover because we may have
-                 * destroyed the original data by calling H5Z_pipeline().
-                 * The only safe option is to continue with the reset
-                 * even if we can't write the data to disk.
-                 */
-                point_of_no_return = TRUE;
-                ent->chunk = NULL;
+                if(!reset) {
+                    /*
+                     * Copy the chunk to a new buffer before running it through
+                     * the pipeline because we'll want to save the original buffer
+                     * for later.
+                     */
+                    if(NULL == (buf = H5MM_malloc(alloc)))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+                    HDmemcpy(buf, ent->chunk, alloc);
+                } /* end if */
+                else {
+                    /*
+                     * If we are reseting and something goes wrong after this
+                     * point then it's too late to recover because we may have
+                     * destroyed the original data by calling H5Z_pipeline().
+                     * The only safe option is to continue with the reset
+                     * even if we can't write the data to disk.
+                     */
+                    point_of_no_return = TRUE;
+                    ent->chunk = NULL;
+                } /* end else */
+                H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
+                if(H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), dxpl_cache->err_detect,
+                         dxpl_cache->filter_cb, &nbytes, &alloc, &buf) < 0)
+                    HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
             } /* end else */
-            H5_CHECKED_ASSIGN(nbytes, size_t, udata.chunk_block.length, hsize_t);
-            if(H5Z_pipeline(&(dset->shared->dcpl_cache.pline), 0, &(udata.filter_mask), dxpl_cache->err_detect,
-                     dxpl_cache->filter_cb, &nbytes, &alloc, &buf) < 0)
-                HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
 #if H5_SIZEOF_SIZE_T > 4
             /* Check for the chunk expanding too much to encode in a 32-bit value */
             if(nbytes > ((size_t)0xffffffff))
@@ -3181,7 +5228,7 @@ H5D__chunk_flush_entry(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
                 HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "unable to insert chunk addr into index")
 
         /* Cache the chunk's info, in case it's accessed again shortly */
-        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk.last, &udata);
+        H5D__chunk_cinfo_cache_update(&dset->shared->cache.chunk, &udata);
 
         /* Mark cache entry as clean */
         ent->dirty = FALSE;
@@ -3221,6 +5268,113 @@ done:
     FUNC_LEAVE_NOAPI_TAG(ret_value, FAIL)
 } /* end H5D__chunk_flush_entry() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_flush_batch
+ *
+ * Purpose:	Writes back the cache entries from *ENT_P on, up to and
+ *		including the Nth dirty chunk that has filters, where N is
+ *		twice the number of filter threads.  The filters run on
+ *		copies of those N chunks concurrently first; allocating file
+ *		space, updating the chunk index and writing the chunks still
+ *		happens one chunk at a time, in list order.  If EVICT is set
+ *		the entries are also preempted from the cache.
+ *
+ *		On return *ENT_P points to the first entry that wasn't
+ *		written back, even on failure.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_flush_batch(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, H5D_rdcc_ent_t **ent_p, hbool_t evict)
+{
+    const H5D_rdcc_t *rdcc = &(dset->shared->cache.chunk); /* Raw data chunk cache */
+    H5D_chunk_filt_t *filts = NULL;     /* Copies of the chunks to filter */
+    H5D_rdcc_ent_t *ent, *next;         /* Cache entries */
+    H5D_rdcc_ent_t *stop;               /* First entry after the batch */
+    size_t      chunk_size;             /* Size of a chunk */
+    size_t      nbatch;                 /* Maximum number of chunks to filter */
+    size_t      nfilts = 0;             /* Number of chunks to filter */
+    size_t      u;                      /* Local index variable */
+    unsigned    nerrors = 0;            /* Number of chunks that failed */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(dxpl_cache);
+    HDassert(ent_p);
+    HDassert(dset->shared->dcpl_cache.pline.nused > 0);
+
+    H5_CHECKED_ASSIGN(chunk_size, size_t, dset->shared->layout.u.chunk.size, uint32_t);
+    nbatch = 2 * (size_t)MAX(rdcc->filter_nthreads, 1);
+    if(NULL == (filts = (H5D_chunk_filt_t *)H5MM_calloc(nbatch * sizeof(H5D_chunk_filt_t)))) {
+        *ent_p = NULL;
+        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for chunk batch")
+    } /* end if */
+
+    /* Copy the dirty chunks that will be filtered */
+    for(ent = *ent_p; ent && nfilts < nbatch; ent = ent->next)
+        if(ent->dirty && !ent->locked && !(ent->edge_chunk_state & H5D_RDCC_DISABLE_FILTERS)) {
+            H5D_chunk_filt_t *filt = &filts[nfilts++];
+
+            filt->ent = ent;
+            HDmemcpy(filt->scaled, ent->scaled, sizeof(hsize_t) * dset->shared->ndims);
+            filt->addr = ent->chunk_block.offset;
+            filt->nbytes = filt->buf_alloc = chunk_size;
+            filt->filter_mask = 0;
+            filt->status = SUCCEED;
+            if(NULL == (filt->buf = H5MM_malloc(chunk_size))) {
+                *ent_p = NULL;
+                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, FAIL, "memory allocation failed for pipeline")
+            } /* end if */
+            HDmemcpy(filt->buf, ent->chunk, chunk_size);
+        } /* end if */
+    stop = ent;
+
+    /* Run the filters on all the chunks at once */
+    if(nfilts > 0)
+        if(H5D__chunk_filter_bufs(&(dset->shared->dcpl_cache.pline), 0, rdcc->filter_nthreads,
+                dxpl_cache, filts, nfilts) < 0) {
+            *ent_p = stop;
+            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "output pipeline failed")
+        } /* end if */
+
+    /* Write the entries back in list order */
+    for(ent = *ent_p, u = 0; ent != stop; ent = next) {
+        H5D_chunk_filt_t *filt = NULL;
+
+        next = ent->next;
+        if(u < nfilts && filts[u].ent == ent)
+            filt = &filts[u++];
+        if(ent->locked)
+            continue;
+
+        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE, filt) < 0)
+            nerrors++;
+        if(evict && H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, ent, TRUE) < 0)
+            nerrors++;
+    } /* end for */
+    *ent_p = stop;
+
+    if(nerrors)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
+
+done:
+    if(filts) {
+        for(u = 0; u < nfilts; u++)
+            if(filts[u].buf)
+                H5MM_xfree(filts[u].buf);
+        filts = (H5D_chunk_filt_t *)H5MM_xfree(filts);
+    } /* end if */
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_flush_batch() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__chunk_cache_evict
@@ -3248,11 +5402,11 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
     HDassert(dxpl_cache);
     HDassert(ent);
     HDassert(!ent->locked);
-    HDassert(ent->idx < rdcc->nslots);
+    HDassert(ent->idx < rdcc->slot_nalloc);
 
     if(flush) {
         /* Flush */
-        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, TRUE) < 0)
+        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, TRUE, NULL) < 0)
             HDONE_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
     } /* end if */
     else {
@@ -3263,151 +5417,517 @@ H5D__chunk_cache_evict(const H5D_t *dset, hid_t dxpl_id, const H5D_dxpl_cache_t
                     : &(dset->shared->dcpl_cache.pline)));
     } /* end else */
 
-    /* Unlink from list */
-    if(ent->prev)
-        ent->prev->next = ent->next;
-    else
-        rdcc->head = ent->next;
-    if(ent->next)
-        ent->next->prev = ent->prev;
-    else
-        rdcc->tail = ent->prev;
-    ent->prev = ent->next = NULL;
+    /* Unlink from list */
+    if(ent->prev)
+        ent->prev->next = ent->next;
+    else
+        rdcc->head = ent->next;
+    if(ent->next)
+        ent->next->prev = ent->prev;
+    else
+        rdcc->tail = ent->prev;
+    ent->prev = ent->next = NULL;
+
+    /* Clear the hash table slot, leaving a marker for lookups to probe past */
+    HDassert(rdcc->slot[ent->idx] == ent);
+    rdcc->slot[ent->idx] = H5D_RDCC_SLOT_DELETED;
+    rdcc->slot_ndeleted++;
+
+    /* Unlink from the file-wide shared cache */
+    if(rdcc->shared_cache) {
+        H5D_RDCC_SHARED_UNLINK(rdcc->shared_cache, ent)
+        rdcc->shared_cache->nbytes_used -= dset->shared->layout.u.chunk.size;
+        --rdcc->shared_cache->nused;
+    } /* end if */
+
+    /* Remove from the 2Q probationary queue */
+    if(H5D_CHUNK_CACHE_POLICY_2Q == rdcc->policy && !ent->hot)
+        --rdcc->nprobation;
+
+    /* Remove from cache */
+    HDassert(rdcc->slot[ent->idx] != ent);
+    ent->idx = UINT_MAX;
+    rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
+    --rdcc->nused;
+
+    /* Free */
+    ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
+
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_evict() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_prune
+ *
+ * Purpose:	Prune the cache by preempting some things until the cache has
+ *		room for something which is SIZE bytes.  Only unlocked
+ *		entries are considered for preemption.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ * Programmer:	Robb Matzke
+ *              Thursday, May 21, 1998
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, size_t size)
+{
+    const H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);
+    size_t		total = rdcc->nbytes_max;
+    const int		nmeth = 2;	/*number of methods		*/
+    int		        w[1];		/*weighting as an interval	*/
+    H5D_rdcc_ent_t	*p[2], *cur;	/*list pointers			*/
+    H5D_rdcc_ent_t	*n[2];		/*list next pointers		*/
+    int		nerrors = 0;            /* Accumulated error count during preemptions */
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /*
+     * Preemption is accomplished by having multiple pointers (currently two)
+     * slide down the list beginning at the head. Pointer p(N+1) will start
+     * traversing the list when pointer pN reaches wN percent of the original
+     * list.  In other words, preemption method N gets to consider entries in
+     * approximate least recently used order w0 percent before method N+1
+     * where 100% means tha method N will run to completion before method N+1
+     * begins.  The pointers participating in the list traversal are each
+     * given a chance at preemption before any of the pointers are advanced.
+     */
+    w[0] = (int)(rdcc->nused * rdcc->w0);
+    p[0] = rdcc->head;
+    p[1] = NULL;
+
+    while((p[0] || p[1]) && (rdcc->nbytes_used + size) > total) {
+        int i;          /* Local index variable */
+
+	/* Introduce new pointers */
+	for(i = 0; i < nmeth - 1; i++)
+            if(0 == w[i])
+                p[i + 1] = rdcc->head;
+
+	/* Compute next value for each pointer */
+	for(i = 0; i < nmeth; i++)
+            n[i] = p[i] ? p[i]->next : NULL;
+
+	/* Give each method a chance */
+	for(i = 0; i < nmeth && (rdcc->nbytes_used + size) > total; i++) {
+	    if(0 == i && p[0] && !p[0]->locked &&
+                    ((0 == p[0]->rd_count && 0 == p[0]->wr_count) ||
+                     (0 == p[0]->rd_count && dset->shared->layout.u.chunk.size == p[0]->wr_count) ||
+                     (dset->shared->layout.u.chunk.size == p[0]->rd_count && 0 == p[0]->wr_count))) {
+		/*
+		 * Method 0: Preempt entries that have been completely written
+		 * and/or completely read but not entries that are partially
+		 * written or partially read.
+		 */
+		cur = p[0];
+	    } else if(1 == i && p[1] && !p[1]->locked) {
+		/*
+		 * Method 1: Preempt the entry without regard to
+		 * considerations other than being locked.  This is the last
+		 * resort preemption.
+		 */
+		cur = p[1];
+	    } else {
+		/* Nothing to preempt at this point */
+		cur = NULL;
+	    }
+
+	    if(cur) {
+                int j;          /* Local index variable */
+
+		for(j = 0; j < nmeth; j++) {
+		    if(p[j] == cur)
+                        p[j] = NULL;
+		    if(n[j] == cur)
+                        n[j] = cur->next;
+		} /* end for */
+		if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, cur, TRUE) < 0)
+                    nerrors++;
+	    } /* end if */
+	} /* end for */
+
+	/* Advance pointers */
+	for(i = 0; i < nmeth; i++)
+            p[i] = n[i];
+	for(i = 0; i < nmeth - 1; i++)
+            w[i] -= 1;
+    } /* end while */
+
+    if(nerrors)
+	HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_prune() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_prune_2q
+ *
+ * Purpose:	Prune the cache with the 2Q replacement policy until the
+ *		cache has room for something which is SIZE bytes.  Only
+ *		unlocked entries are considered for preemption.
+ *
+ *		The oldest probationary entry is preempted while the
+ *		probationary queue holds more than a quarter of the cache,
+ *		otherwise the least recently used protected entry is.
+ *		Preempted probationary entries are remembered as ghosts, so
+ *		that they are protected when they are read back in.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_cache_prune_2q(const H5D_t *dset, hid_t dxpl_id,
+    const H5D_dxpl_cache_t *dxpl_cache, size_t size)
+{
+    H5D_rdcc_t		*rdcc = &(dset->shared->cache.chunk);
+    size_t		total = rdcc->nbytes_max;
+    size_t              chunk_size = dset->shared->layout.u.chunk.size;
+    H5D_rdcc_ent_t	*cold, *hot, *cur;      /* List pointers for each queue */
+    int		nerrors = 0;            /* Accumulated error count during preemptions */
+    herr_t      ret_value = SUCCEED;       /* Return value */
+
+    FUNC_ENTER_STATIC
+
+    /* Both queues are kept on the same list, in order of insertion for the
+     * probationary queue and in LRU order for the protected queue, so one
+     * pointer per queue slides down the list from the head.
+     */
+    cold = hot = rdcc->head;
+    while((rdcc->nbytes_used + size) > total) {
+        /* Advance to the next unlocked entry on each queue */
+        while(cold && (cold->locked || cold->hot))
+            cold = cold->next;
+        while(hot && (hot->locked || !hot->hot))
+            hot = hot->next;
+
+        /* Choose the queue to preempt from */
+        if(cold && (!hot || ((size_t)rdcc->nprobation * chunk_size) > (total / 4))) {
+            cur = cold;
+            cold = cold->next;
+            H5D__chunk_cache_ghost_add(dset->shared, cur->scaled);
+        } /* end if */
+        else if(hot) {
+            cur = hot;
+            hot = hot->next;
+        } /* end if */
+        else
+            /* Nothing left to preempt */
+            break;
+
+        if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, cur, TRUE) < 0)
+            nerrors++;
+    } /* end while */
+
+    if(nerrors)
+	HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_prune_2q() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_ghost_add
+ *
+ * Purpose:	Remember the scaled coordinates of a chunk preempted from
+ *		the 2Q probationary queue, overwriting the oldest ghost
+ *		when the ring is full.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_ghost_add(H5D_shared_t *shared, const hsize_t *scaled)
+{
+    H5D_rdcc_t *rdcc = &(shared->cache.chunk);  /* Chunk cache */
+    unsigned    ndims = shared->ndims;          /* Rank of dataset */
+    hsize_t    *ghost;          /* Ring position to write */
+    size_t      mask;           /* Mask for ghost hash table indices */
+    size_t      idx;            /* Ghost hash table index */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(rdcc->ghost);
+    HDassert(rdcc->ghost_slot);
+    HDassert(scaled);
+
+    ghost = rdcc->ghost + (rdcc->ghost_next * ndims);
+    mask = rdcc->ghost_nslots - 1;
+
+    /* Forget the oldest ghost, if it is overwritten and still indexed */
+    if(rdcc->nghosts == rdcc->nghosts_max && ghost[0] != HSIZE_UNDEF) {
+        for(idx = H5D__chunk_hash_val(shared, ghost, rdcc->ghost_nbits); rdcc->ghost_slot[idx] != rdcc->ghost_next + 1; idx = (idx + 1) & mask)
+            HDassert(rdcc->ghost_slot[idx]);
+        H5D__chunk_cache_ghost_unlink(shared, idx);
+    } /* end if */
+
+    /* Store the ghost and index it */
+    HDmemcpy(ghost, scaled, ndims * sizeof(hsize_t));
+    for(idx = H5D__chunk_hash_val(shared, scaled, rdcc->ghost_nbits); rdcc->ghost_slot[idx]; idx = (idx + 1) & mask)
+        ;
+    rdcc->ghost_slot[idx] = rdcc->ghost_next + 1;
+
+    rdcc->ghost_next = (rdcc->ghost_next + 1) % rdcc->nghosts_max;
+    if(rdcc->nghosts < rdcc->nghosts_max)
+        rdcc->nghosts++;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_ghost_add() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_ghost_remove
+ *
+ * Purpose:	Look for a chunk in the 2Q ghost hash table and forget it
+ *		if it is found.
+ *
+ * Return:	TRUE if the chunk was a ghost, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5D__chunk_cache_ghost_remove(H5D_shared_t *shared, const hsize_t *scaled)
+{
+    H5D_rdcc_t *rdcc = &(shared->cache.chunk);  /* Chunk cache */
+    unsigned    ndims = shared->ndims;          /* Rank of dataset */
+    size_t      idx;            /* Ghost hash table index */
+    hbool_t     ret_value = FALSE;      /* Return value */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(rdcc->ghost);
+    HDassert(rdcc->ghost_slot);
+    HDassert(scaled);
+
+    /* The table is at most half full, so the probe terminates */
+    for(idx = H5D__chunk_hash_val(shared, scaled, rdcc->ghost_nbits); rdcc->ghost_slot[idx]; idx = (idx + 1) & (rdcc->ghost_nslots - 1)) {
+        hsize_t *ghost = rdcc->ghost + ((rdcc->ghost_slot[idx] - 1) * ndims);
+
+        if(!HDmemcmp(ghost, scaled, ndims * sizeof(hsize_t))) {
+            /* Invalidate the ghost in the ring; scaled coordinates are
+             * never HSIZE_UNDEF */
+            ghost[0] = HSIZE_UNDEF;
+            H5D__chunk_cache_ghost_unlink(shared, idx);
+            HGOTO_DONE(TRUE)
+        } /* end if */
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_cache_ghost_remove() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_ghost_unlink
+ *
+ * Purpose:	Remove slot IDX from the 2Q ghost hash table, moving back
+ *		the ghosts after it in its probe sequence so that no
+ *		deleted slot markers are needed.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_ghost_unlink(H5D_shared_t *shared, size_t idx)
+{
+    H5D_rdcc_t *rdcc = &(shared->cache.chunk);  /* Chunk cache */
+    size_t      mask = rdcc->ghost_nslots - 1;  /* Mask for table indices */
+    size_t      hole = idx;     /* Slot to fill */
+    size_t      next = idx;     /* Slot to consider moving */
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(rdcc->ghost_slot[idx]);
+
+    for(;;) {
+        size_t home;            /* Home slot of the ghost in 'next' */
+
+        next = (next + 1) & mask;
+        if(0 == rdcc->ghost_slot[next])
+            break;
+
+        /* The ghost stays where it is if its home slot is cyclically
+         * after the hole and no later than its slot */
+        home = H5D__chunk_hash_val(shared, rdcc->ghost + ((rdcc->ghost_slot[next] - 1) * shared->ndims), rdcc->ghost_nbits);
+        if(hole <= next ? (hole < home && home <= next) : (hole < home || home <= next))
+            continue;
+
+        rdcc->ghost_slot[hole] = rdcc->ghost_slot[next];
+        hole = next;
+    } /* end for */
+    rdcc->ghost_slot[hole] = 0;
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_ghost_unlink() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_cache_ghost_rehash
+ *
+ * Purpose:	Rebuild the 2Q ghost hash table from the ring, after the
+ *		scaled dimension sizes it is keyed with changed.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5D__chunk_cache_ghost_rehash(H5D_shared_t *shared)
+{
+    H5D_rdcc_t *rdcc = &(shared->cache.chunk);  /* Chunk cache */
+    size_t      mask = rdcc->ghost_nslots - 1;  /* Mask for table indices */
+    size_t      u;              /* Local index variable */
+
+    FUNC_ENTER_STATIC_NOERR
 
-    /* Unlink from temporary list */
-    if(ent->tmp_prev) {
-        HDassert(rdcc->tmp_head->tmp_next);
-        ent->tmp_prev->tmp_next = ent->tmp_next;
-        if(ent->tmp_next) {
-            ent->tmp_next->tmp_prev = ent->tmp_prev;
-            ent->tmp_next = NULL;
-        } /* end if */
-        ent->tmp_prev = NULL;
-    } /* end if */
-    else
-        /* Only clear hash table slot if the chunk was not on the temporary list
-         */
-        rdcc->slot[ent->idx] = NULL;
+    /* Sanity checks */
+    HDassert(rdcc->ghost);
+    HDassert(rdcc->ghost_slot);
 
-    /* Remove from cache */
-    HDassert(rdcc->slot[ent->idx] != ent);
-    ent->idx = UINT_MAX;
-    rdcc->nbytes_used -= dset->shared->layout.u.chunk.size;
-    --rdcc->nused;
+    HDmemset(rdcc->ghost_slot, 0, rdcc->ghost_nslots * sizeof(size_t));
+    for(u = 0; u < rdcc->nghosts; u++) {
+        hsize_t *ghost = rdcc->ghost + (u * shared->ndims);
 
-    /* Free */
-    ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
+        if(ghost[0] != HSIZE_UNDEF) {
+            size_t idx;         /* Ghost hash table index */
 
-    FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_cache_evict() */
+            for(idx = H5D__chunk_hash_val(shared, ghost, rdcc->ghost_nbits); rdcc->ghost_slot[idx]; idx = (idx + 1) & mask)
+                ;
+            rdcc->ghost_slot[idx] = u + 1;
+        } /* end if */
+    } /* end for */
+
+    FUNC_LEAVE_NOAPI_VOID
+} /* end H5D__chunk_cache_ghost_rehash() */
 
 
 /*-------------------------------------------------------------------------
- * Function:	H5D__chunk_cache_prune
+ * Function:	H5D__chunk_cache_prune_shared
  *
- * Purpose:	Prune the cache by preempting some things until the cache has
- *		room for something which is SIZE bytes.  Only unlocked
- *		entries are considered for preemption.
+ * Purpose:	Prune the file-wide shared chunk cache by preempting the
+ *		least recently used unlocked entries, from any dataset in
+ *		the file, until the shared cache has room for something
+ *		which is SIZE bytes.
  *
- * Return:	Non-negative on success/Negative on failure
+ *		Entries that belong to another dataset are flushed through
+ *		an open handle of that dataset, which its chunk cache keeps
+ *		as long as it has chunks in the shared cache.
  *
- * Programmer:	Robb Matzke
- *              Thursday, May 21, 1998
+ * Return:	Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5D__chunk_cache_prune(const H5D_t *dset, hid_t dxpl_id,
+H5D__chunk_cache_prune_shared(const H5D_t *dset, hid_t dxpl_id,
     const H5D_dxpl_cache_t *dxpl_cache, size_t size)
 {
-    const H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);
-    size_t		total = rdcc->nbytes_max;
-    const int		nmeth = 2;	/*number of methods		*/
-    int		        w[1];		/*weighting as an interval	*/
-    H5D_rdcc_ent_t	*p[2], *cur;	/*list pointers			*/
-    H5D_rdcc_ent_t	*n[2];		/*list next pointers		*/
+    H5F_rdcc_shared_t   *sc = dset->shared->cache.chunk.shared_cache;  /* File-wide cache */
+    H5D_rdcc_ent_t	*cur, *next;    /* List pointers */
     int		nerrors = 0;            /* Accumulated error count during preemptions */
-    herr_t      ret_value = SUCCEED;       /* Return value */
+    herr_t      ret_value = SUCCEED;    /* Return value */
 
     FUNC_ENTER_STATIC
 
-    /*
-     * Preemption is accomplished by having multiple pointers (currently two)
-     * slide down the list beginning at the head. Pointer p(N+1) will start
-     * traversing the list when pointer pN reaches wN percent of the original
-     * list.  In other words, preemption method N gets to consider entries in
-     * approximate least recently used order w0 percent before method N+1
-     * where 100% means tha method N will run to completion before method N+1
-     * begins.  The pointers participating in the list traversal are each
-     * given a chance at preemption before any of the pointers are advanced.
-     */
-    w[0] = (int)(rdcc->nused * rdcc->w0);
-    p[0] = rdcc->head;
-    p[1] = NULL;
-
-    while((p[0] || p[1]) && (rdcc->nbytes_used + size) > total) {
-        int i;          /* Local index variable */
+    /* Sanity check */
+    HDassert(sc);
 
-	/* Introduce new pointers */
-	for(i = 0; i < nmeth - 1; i++)
-            if(0 == w[i])
-                p[i + 1] = rdcc->head;
+    for(cur = sc->head; cur && (sc->nbytes_used + size) > sc->nbytes_max; cur = next) {
+        next = cur->sh_next;
 
-	/* Compute next value for each pointer */
-	for(i = 0; i < nmeth; i++)
-            n[i] = p[i] ? p[i]->next : NULL;
+        /* Locked entries can't be preempted */
+        if(cur->locked)
+            continue;
 
-	/* Give each method a chance */
-	for(i = 0; i < nmeth && (rdcc->nbytes_used + size) > total; i++) {
-	    if(0 == i && p[0] && !p[0]->locked &&
-                    ((0 == p[0]->rd_count && 0 == p[0]->wr_count) ||
-                     (0 == p[0]->rd_count && dset->shared->layout.u.chunk.size == p[0]->wr_count) ||
-                     (dset->shared->layout.u.chunk.size == p[0]->rd_count && 0 == p[0]->wr_count))) {
-		/*
-		 * Method 0: Preempt entries that have been completely written
-		 * and/or completely read but not entries that are partially
-		 * written or partially read.
-		 */
-		cur = p[0];
-	    } else if(1 == i && p[1] && !p[1]->locked) {
-		/*
-		 * Method 1: Preempt the entry without regard to
-		 * considerations other than being locked.  This is the last
-		 * resort preemption.
-		 */
-		cur = p[1];
-	    } else {
-		/* Nothing to preempt at this point */
-		cur = NULL;
-	    }
+        if(cur->dset_shared == dset->shared) {
+            if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, cur, TRUE) < 0)
+                nerrors++;
+        } /* end if */
+        else {
+            const H5D_t *owner = cur->dset_shared->cache.chunk.owner;  /* Open handle of the entry's dataset */
 
-	    if(cur) {
-                int j;          /* Local index variable */
+            /* A dataset with chunks in the cache always has a handle to
+             * flush them through (see H5D__chunk_owner_close) */
+            HDassert(owner);
+            HDassert(owner->shared == cur->dset_shared);
 
-		for(j = 0; j < nmeth; j++) {
-		    if(p[j] == cur)
-                        p[j] = NULL;
-		    if(n[j] == cur)
-                        n[j] = cur->next;
-		} /* end for */
-		if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, cur, TRUE) < 0)
-                    nerrors++;
-	    } /* end if */
-	} /* end for */
+            /* Account for the preemption in the owning dataset */
+            cur->dset_shared->cache.chunk.stats.nshared_evicts++;
 
-	/* Advance pointers */
-	for(i = 0; i < nmeth; i++)
-            p[i] = n[i];
-	for(i = 0; i < nmeth - 1; i++)
-            w[i] -= 1;
-    } /* end while */
+            if(H5D__chunk_cache_evict(owner, dxpl_id, dxpl_cache, cur, TRUE) < 0)
+                nerrors++;
+        } /* end else */
+    } /* end for */
 
     if(nerrors)
 	HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to preempt one or more raw data cache entry")
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
-} /* end H5D__chunk_cache_prune() */
+} /* end H5D__chunk_cache_prune_shared() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5D__chunk_owner_close
+ *
+ * Purpose:	Called when an open handle of a dataset closes while other
+ *		handles keep the dataset open.  If the dataset's chunks in
+ *		the file-wide shared cache are flushed through DSET, they
+ *		are flushed and evicted now, and the next handle that
+ *		caches a chunk takes over.  Other datasets preempting the
+ *		chunks then never use a closed handle.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5D__chunk_owner_close(const H5D_t *dset, hid_t dxpl_id)
+{
+    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
+    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
+    H5D_rdcc_t	*rdcc = &(dset->shared->cache.chunk);   /* Dataset's chunk cache */
+    H5D_rdcc_ent_t	*ent, *next;    /* Pointer to current & next cache entries */
+    int		nerrors = 0;            /* Accumulated count of errors */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Sanity checks */
+    HDassert(dset);
+    HDassert(H5D_CHUNKED == dset->shared->layout.type);
+
+    if(rdcc->owner == dset) {
+        /* Fill the DXPL cache values for later use */
+        if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
+
+        /* Flush and evict the dataset's chunks */
+        for(ent = rdcc->head; ent; ent = next) {
+            next = ent->next;
+            if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, ent, TRUE) < 0)
+                nerrors++;
+        } /* end for */
+        rdcc->owner = NULL;
+
+        if(nerrors)
+            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
+    } /* end if */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5D__chunk_owner_close() */
 
 
 /*-------------------------------------------------------------------------
@@ -3465,7 +5985,6 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
     HDassert(TRUE == H5P_isa_class(io_info->md_dxpl_id, H5P_DATASET_XFER));
     HDassert(TRUE == H5P_isa_class(io_info->raw_dxpl_id, H5P_DATASET_XFER));
     HDassert(!(udata->new_unfilt_chunk && prev_unfilt_chunk));
-    HDassert(!rdcc->tmp_head);
 
     /* Get the chunk's size */
     HDassert(layout->u.chunk.size > 0);
@@ -3474,7 +5993,7 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
     /* Check if the chunk is in the cache */
     if(UINT_MAX != udata->idx_hint) {
         /* Sanity check */
-        HDassert(udata->idx_hint < rdcc->nslots);
+        HDassert(udata->idx_hint < rdcc->slot_nalloc);
         HDassert(rdcc->slot[udata->idx_hint]);
 
         /* Get the entry */
@@ -3494,6 +6013,10 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
          * Already in the cache.  Count a hit.
          */
         rdcc->stats.nhits++;
+        if(ent->prefetched) {
+            rdcc->stats.nprefetch_hits++;
+            ent->prefetched = FALSE;
+        } /* end if */
 
         /* Make adjustments if the edge chunk status changed recently */
         if(pline->nused) {
@@ -3555,12 +6078,31 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
             } /* end else */
         } /* end if */
 
+        if(H5D_CHUNK_CACHE_POLICY_2Q == rdcc->policy) {
+            /*
+             * 2Q: hits on the probationary queue are ignored, so that the
+             * repeated accesses of a single pass over a chunk don't promote
+             * it.  Entries on the protected queue move to the most recently
+             * used end of the list.
+             */
+            if(ent->hot && ent->next) {
+                ent->next->prev = ent->prev;
+                if(ent->prev)
+                    ent->prev->next = ent->next;
+                else
+                    rdcc->head = ent->next;
+                rdcc->tail->next = ent;
+                ent->prev = rdcc->tail;
+                ent->next = NULL;
+                rdcc->tail = ent;
+            } /* end if */
+        } /* end if */
         /*
          * If the chunk is not at the beginning of the cache; move it backward
          * by one slot.  This is how we implement the LRU preemption
          * algorithm.
          */
-        if(ent->next) {
+        else if(ent->next) {
             if(ent->next->next)
                 ent->next->next->prev = ent;
             else
@@ -3574,6 +6116,14 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
             ent->next = ent->next->next;
             ent->prev->next = ent;
         } /* end if */
+
+        /* The file-wide shared cache is strictly LRU: move the entry to the
+         * most recently used end of the list.
+         */
+        if(rdcc->shared_cache && ent != rdcc->shared_cache->tail) {
+            H5D_RDCC_SHARED_UNLINK(rdcc->shared_cache, ent)
+            H5D_RDCC_SHARED_APPEND(rdcc->shared_cache, ent)
+        } /* end if */
     } /* end if */
     else {
         haddr_t             chunk_addr;         /* Address of chunk on disk */
@@ -3642,37 +6192,51 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
             if(H5F_addr_defined(chunk_addr)) {
                 size_t my_chunk_alloc = chunk_alloc;	/* Allocated buffer size */
                 size_t buf_alloc = chunk_alloc;	        /* [Re-]allocated buffer size */
+                hbool_t staged = FALSE;                 /* Whether the chunk was unfiltered in a batch */
 
-                /* Chunk size on disk isn't [likely] the same size as the final chunk
-                 * size in memory, so allocate memory big enough. */
-                if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, (udata->new_unfilt_chunk ? old_pline : pline))))
-                    HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
-                if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, my_chunk_alloc, io_info->raw_dxpl_id, chunk) < 0)
-                    HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
-
-                if(old_pline && old_pline->nused) {
-                    if(H5Z_pipeline(old_pline, H5Z_FLAG_REVERSE,
-                            &(udata->filter_mask),
-                            io_info->dxpl_cache->err_detect,
-                            io_info->dxpl_cache->filter_cb,
-                            &my_chunk_alloc, &buf_alloc, &chunk) < 0)
-                        HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, NULL, "data pipeline read failed")
-
-                    /* Reallocate chunk if necessary */
-                    if(udata->new_unfilt_chunk) {
-                        void *tmp_chunk = chunk;
-
-                        if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, pline))) {
+                /* Check if the chunk was already read and unfiltered, in a
+                 * batch with other chunks.
+                 */
+                if(old_pline && old_pline->nused && !udata->new_unfilt_chunk
+                        && rdcc->nstaged > 0)
+                    staged = H5D__chunk_stage_take(rdcc, dset->shared->ndims,
+                            udata->common.scaled, chunk_addr, &chunk,
+                            &my_chunk_alloc, &(udata->filter_mask));
+                if(!staged) {
+                    /* Chunk size on disk isn't [likely] the same size as the final chunk
+                     * size in memory, so allocate memory big enough. */
+                    if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, (udata->new_unfilt_chunk ? old_pline : pline))))
+                        HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
+                    if(H5F_block_read(dset->oloc.file, H5FD_MEM_DRAW, chunk_addr, my_chunk_alloc, io_info->raw_dxpl_id, chunk) < 0)
+                        HGOTO_ERROR(H5E_IO, H5E_READERROR, NULL, "unable to read raw data chunk")
+
+                    if(old_pline && old_pline->nused) {
+                        if(H5Z_pipeline(old_pline, H5Z_FLAG_REVERSE,
+                                &(udata->filter_mask),
+                                io_info->dxpl_cache->err_detect,
+                                io_info->dxpl_cache->filter_cb,
+                                &my_chunk_alloc, &buf_alloc, &chunk) < 0)
+                            HGOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, NULL, "data pipeline read failed")
+
+                        /* Reallocate chunk if necessary */
+                        if(udata->new_unfilt_chunk) {
+                            void *tmp_chunk = chunk;
+
+                            if(NULL == (chunk = H5D__chunk_mem_alloc(my_chunk_alloc, pline))) {
+                                (void)H5D__chunk_mem_xfree(tmp_chunk, old_pline);
+                                HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
+                            } /* end if */
+                            HDmemcpy(chunk, tmp_chunk, chunk_size);
                             (void)H5D__chunk_mem_xfree(tmp_chunk, old_pline);
-                            HGOTO_ERROR(H5E_RESOURCE, H5E_NOSPACE, NULL, "memory allocation failed for raw data chunk")
                         } /* end if */
-                        HDmemcpy(chunk, tmp_chunk, chunk_size);
-                        (void)H5D__chunk_mem_xfree(tmp_chunk, old_pline);
                     } /* end if */
                 } /* end if */
 
-                /* Increment # of cache misses */
-                rdcc->stats.nmisses++;
+                /* Increment # of cache misses, or of chunks read ahead */
+                if(rdcc->prefetching)
+                    rdcc->stats.nprefetches++;
+                else
+                    rdcc->stats.nmisses++;
             } /* end if */
             else {
                 H5D_fill_value_t	fill_status;
@@ -3721,60 +6285,89 @@ H5D__chunk_lock(const H5D_io_info_t *io_info, H5D_chunk_ud_t *udata,
 
         /* See if the chunk can be cached */
         if(rdcc->nslots > 0 && chunk_size <= rdcc->nbytes_max) {
-            /* Calculate the index */
-            udata->idx_hint = H5D__chunk_hash_val(io_info->dset->shared, udata->common.scaled);
-
-            /* Add the chunk to the cache only if the slot is not already locked */
-            ent = rdcc->slot[udata->idx_hint];
-            if(!ent || !ent->locked) {
-                /* Preempt enough things from the cache to make room */
-                if(ent) {
-                    if(H5D__chunk_cache_evict(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, ent, TRUE) < 0)
-                        HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk from cache")
-                } /* end if */
+            /* If the least recently used chunk must be preempted and is
+             *  dirty, write it back along with the next few dirty chunks,
+             *  so their filters run concurrently.
+             */
+            if(rdcc->filter_nthreads > 1 && dset->shared->dcpl_cache.pline.nused > 0
+                    && rdcc->nbytes_used + chunk_size > rdcc->nbytes_max
+                    && rdcc->head && rdcc->head->dirty && !rdcc->head->locked) {
+                H5D_rdcc_ent_t *first = rdcc->head;
+
+                if(H5D__chunk_flush_batch(dset, io_info->md_dxpl_id, io_info->dxpl_cache, &first, FALSE) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, NULL, "unable to flush raw data chunks")
+            } /* end if */
+
+            /* Preempt enough things from the cache to make room */
+            if(H5D_CHUNK_CACHE_POLICY_2Q == rdcc->policy) {
+                if(H5D__chunk_cache_prune_2q(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, chunk_size) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
+            } /* end if */
+            else
                 if(H5D__chunk_cache_prune(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, chunk_size) < 0)
                     HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from cache")
+            if(rdcc->shared_cache)
+                if(H5D__chunk_cache_prune_shared(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, chunk_size) < 0)
+                    HGOTO_ERROR(H5E_IO, H5E_CANTINIT, NULL, "unable to preempt chunk(s) from shared cache")
 
-                /* Create a new entry */
-                if(NULL == (ent = H5FL_CALLOC(H5D_rdcc_ent_t)))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "can't allocate raw data chunk entry")
-
-                ent->edge_chunk_state = disable_filters ? H5D_RDCC_DISABLE_FILTERS : 0;
-                if(udata->new_unfilt_chunk)
-                    ent->edge_chunk_state |= H5D_RDCC_NEWLY_DISABLED_FILTERS;
-
-                /* Initialize the new entry */
-                ent->chunk_block.offset = chunk_addr;
-                ent->chunk_block.length = chunk_alloc;
-                ent->chunk_idx = udata->chunk_idx;
-                HDmemcpy(ent->scaled, udata->common.scaled, sizeof(hsize_t) * layout->u.chunk.ndims);
-                H5_CHECKED_ASSIGN(ent->rd_count, uint32_t, chunk_size, size_t);
-                H5_CHECKED_ASSIGN(ent->wr_count, uint32_t, chunk_size, size_t);
-                ent->chunk = (uint8_t *)chunk;
+            /* Create a new entry */
+            if(NULL == (ent = H5FL_CALLOC(H5D_rdcc_ent_t)))
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, NULL, "can't allocate raw data chunk entry")
 
-                /* Add it to the cache */
-                HDassert(NULL == rdcc->slot[udata->idx_hint]);
-                rdcc->slot[udata->idx_hint] = ent;
-                ent->idx = udata->idx_hint;
-                rdcc->nbytes_used += chunk_size;
-                rdcc->nused++;
-
-                /* Add it to the linked list */
-                if(rdcc->tail) {
-                    rdcc->tail->next = ent;
-                    ent->prev = rdcc->tail;
-                    rdcc->tail = ent;
-                } /* end if */
-                else
-                    rdcc->head = rdcc->tail = ent;
-                ent->tmp_next = NULL;
-                ent->tmp_prev = NULL;
+            ent->edge_chunk_state = disable_filters ? H5D_RDCC_DISABLE_FILTERS : 0;
+            if(udata->new_unfilt_chunk)
+                ent->edge_chunk_state |= H5D_RDCC_NEWLY_DISABLED_FILTERS;
+
+            /* Initialize the new entry */
+            ent->chunk_block.offset = chunk_addr;
+            ent->chunk_block.length = chunk_alloc;
+            ent->chunk_idx = udata->chunk_idx;
+            ent->prefetched = rdcc->prefetching;
+            HDmemcpy(ent->scaled, udata->common.scaled, sizeof(hsize_t) * layout->u.chunk.ndims);
+            H5_CHECKED_ASSIGN(ent->rd_count, uint32_t, chunk_size, size_t);
+            H5_CHECKED_ASSIGN(ent->wr_count, uint32_t, chunk_size, size_t);
+            ent->chunk = (uint8_t *)chunk;
+
+            /* Add it to the cache */
+            if(H5D__chunk_cache_insert(io_info->dset->shared, ent) < 0) {
+                ent = H5FL_FREE(H5D_rdcc_ent_t, ent);
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, NULL, "unable to insert chunk into cache")
+            } /* end if */
+            udata->idx_hint = ent->idx;
+            rdcc->nbytes_used += chunk_size;
+            rdcc->nused++;
+
+            /* With 2Q, chunks that were recently preempted from the
+             *      probationary queue go straight to the protected queue
+             */
+            if(H5D_CHUNK_CACHE_POLICY_2Q == rdcc->policy) {
+                ent->hot = H5D__chunk_cache_ghost_remove(io_info->dset->shared, ent->scaled);
+                if(!ent->hot)
+                    rdcc->nprobation++;
+            } /* end if */
 
+            /* Add it to the linked list */
+            if(rdcc->tail) {
+                rdcc->tail->next = ent;
+                ent->prev = rdcc->tail;
+                rdcc->tail = ent;
             } /* end if */
             else
-                /* We did not add the chunk to cache */
-                ent = NULL;
-        } /* end else */
+                rdcc->head = rdcc->tail = ent;
+
+            /* Add it to the file-wide shared cache */
+            ent->dset_shared = io_info->dset->shared;
+            if(rdcc->shared_cache) {
+                /* Flush the chunks through this handle if the one they were
+                 * flushed through closed */
+                if(NULL == rdcc->owner)
+                    rdcc->owner = io_info->dset;
+
+                H5D_RDCC_SHARED_APPEND(rdcc->shared_cache, ent)
+                rdcc->shared_cache->nbytes_used += chunk_size;
+                rdcc->shared_cache->nused++;
+            } /* end if */
+        } /* end if */
         else /* No cache set up, or chunk is too large: chunk is uncacheable */
             ent = NULL;
     } /* end else */
@@ -3882,7 +6475,7 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
             fake_ent.chunk_block.length = udata->chunk_block.length;
             fake_ent.chunk = (uint8_t *)chunk;
 
-            if(H5D__chunk_flush_entry(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, &fake_ent, TRUE) < 0)
+            if(H5D__chunk_flush_entry(io_info->dset, io_info->md_dxpl_id, io_info->dxpl_cache, &fake_ent, TRUE, NULL) < 0)
                 HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
         } /* end if */
         else {
@@ -3893,16 +6486,23 @@ H5D__chunk_unlock(const H5D_io_info_t *io_info, const H5D_chunk_ud_t *udata,
     } /* end if */
     else {
         H5D_rdcc_ent_t	*ent;   /* Chunk's entry in the cache */
+        unsigned        idx = udata->idx_hint;  /* Chunk's slot in the hash table */
+
+        /* The hint is stale if the hash table was rebuilt while the chunk
+         * was locked (while locking another chunk), look the chunk up again.
+         */
+        if(idx >= rdcc->slot_nalloc || rdcc->slot[idx] == NULL
+                || rdcc->slot[idx] == H5D_RDCC_SLOT_DELETED || rdcc->slot[idx]->chunk != chunk)
+            idx = H5D__chunk_cache_find(io_info->dset->shared, udata->common.scaled);
 
         /* Sanity check */
-	HDassert(udata->idx_hint < rdcc->nslots);
-	HDassert(rdcc->slot[udata->idx_hint]);
-	HDassert(rdcc->slot[udata->idx_hint]->chunk == chunk);
+	HDassert(idx < rdcc->slot_nalloc);
+	HDassert(rdcc->slot[idx]->chunk == chunk);
 
         /*
          * It's in the cache so unlock it.
          */
-        ent = rdcc->slot[udata->idx_hint];
+        ent = rdcc->slot[idx];
         HDassert(ent->locked);
         if(dirty) {
             ent->dirty = TRUE;
@@ -3983,7 +6583,7 @@ H5D__chunk_allocated(H5D_t *dset, hid_t dxpl_id, hsize_t *nbytes)
     /* Search for cached chunks that haven't been written out */
     for(ent = rdcc->head; ent; ent = ent->next) {
         /* Flush the chunk out to disk, to make certain the size is correct later */
-        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE) < 0)
+        if(H5D__chunk_flush_entry(dset, dxpl_id, dxpl_cache, ent, FALSE, NULL) < 0)
             HGOTO_ERROR(H5E_IO, H5E_WRITEERROR, FAIL, "cannot flush indexed storage buffer")
     } /* end for */
 
@@ -4084,7 +6684,7 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
     for(op_dim = 0; op_dim < (unsigned)space_ndims; op_dim++)
         if(space_dim[op_dim] == 0) {
             /* Reset any cached chunk info for this dataset */
-            H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
+            H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk);
             HGOTO_DONE(SUCCEED)
         } /* end if */
 
@@ -4438,7 +7038,7 @@ H5D__chunk_allocate(const H5D_io_info_t *io_info, hbool_t full_overwrite, hsize_
 #endif /* H5_HAVE_PARALLEL */
 
     /* Reset any cached chunk info for this dataset */
-    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
+    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk);
 
 done:
     /* Release the fill buffer info, if it's been initialized */
@@ -4519,7 +7119,7 @@ H5D__chunk_update_old_edge_chunks(H5D_t *dset, hid_t dxpl_id, hsize_t old_dim[])
     for(op_dim=0; op_dim<space_ndims; op_dim++)
         if((space_dim[op_dim] < chunk_dim[op_dim])  || old_dim[op_dim] == 0) {
             /* Reset any cached chunk info for this dataset */
-            H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
+            H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk);
             HGOTO_DONE(SUCCEED)
         } /* end if */
 
@@ -4629,7 +7229,7 @@ H5D__chunk_update_old_edge_chunks(H5D_t *dset, hid_t dxpl_id, hsize_t old_dim[])
     } /* end for(op_dim=0...) */
 
     /* Reset any cached chunk info for this dataset */
-    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
+    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk);
 
 done:
     FUNC_LEAVE_NOAPI(ret_value)
@@ -5074,7 +7674,7 @@ H5D__chunk_prune_by_extent(H5D_t *dset, hid_t dxpl_id, const hsize_t *old_dim)
     for(op_dim = 0; op_dim < (unsigned)space_ndims; op_dim++)
         if(old_dim[op_dim] == 0) {
             /* Reset any cached chunk info for this dataset */
-            H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
+            H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk);
             HGOTO_DONE(SUCCEED)
         } /* end if */
 
@@ -5331,7 +7931,7 @@ H5D__chunk_prune_by_extent(H5D_t *dset, hid_t dxpl_id, const hsize_t *old_dim)
     } /* end for(op_dim=0...) */
 
     /* Reset any cached chunk info for this dataset */
-    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk.last);
+    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk);
 
 done:
     /* Release resources */
@@ -5526,14 +8126,9 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5D__chunk_update_cache(H5D_t *dset, hid_t dxpl_id)
+H5D__chunk_update_cache(H5D_t *dset, hid_t H5_ATTR_UNUSED dxpl_id)
 {
     H5D_rdcc_t         *rdcc = &(dset->shared->cache.chunk);	/*raw data chunk cache */
-    H5D_rdcc_ent_t     *ent, *next;	/*cache entry  */
-    H5D_rdcc_ent_t     tmp_head;        /* Sentinel entry for temporary entry list */
-    H5D_rdcc_ent_t     *tmp_tail;       /* Tail pointer for temporary entry list */
-    H5D_dxpl_cache_t _dxpl_cache;       /* Data transfer property cache buffer */
-    H5D_dxpl_cache_t *dxpl_cache = &_dxpl_cache;   /* Data transfer property cache */
     herr_t              ret_value = SUCCEED;      /* Return value */
 
     FUNC_ENTER_PACKAGE
@@ -5545,87 +8140,17 @@ H5D__chunk_update_cache(H5D_t *dset, hid_t dxpl_id)
     /* Check the rank */
     HDassert((dset->shared->layout.u.chunk.ndims - 1) > 1);
 
-    /* Fill the DXPL cache values for later use */
-    if(H5D__get_dxpl_cache(dxpl_id, &dxpl_cache) < 0)
-        HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't fill dxpl cache")
-
-    /* Add temporary entry list to rdcc */
-    (void)HDmemset(&tmp_head, 0, sizeof(tmp_head));
-    rdcc->tmp_head = &tmp_head;
-    tmp_tail = &tmp_head;
-
-    /* Recompute the index for each cached chunk that is in a dataset */
-    for(ent = rdcc->head; ent; ent = next) {
-        unsigned	    old_idx;	/* Previous index number	*/
-
-        /* Get the pointer to the next cache entry */
-        next = ent->next;
-
-        /* Compute the index for the chunk entry */
-        old_idx = ent->idx;   /* Save for later */
-        ent->idx = H5D__chunk_hash_val(dset->shared, ent->scaled);
-
-        if(old_idx != ent->idx) {
-            H5D_rdcc_ent_t     *old_ent;	/* Old cache entry  */
-
-            /* Check if there is already a chunk at this chunk's new location */
-            old_ent = rdcc->slot[ent->idx];
-            if(old_ent != NULL) {
-                HDassert(old_ent->locked == FALSE);
-                HDassert(old_ent->deleted == FALSE);
-
-                /* Insert the old entry into the temporary list, but do not
-                 * evict (yet).  Make sure we do not make any calls to the index
-                 * until all chunks have updated indices! */
-                HDassert(!old_ent->tmp_next);
-                HDassert(!old_ent->tmp_prev);
-                tmp_tail->tmp_next = old_ent;
-                old_ent->tmp_prev = tmp_tail;
-                tmp_tail = old_ent;
-            } /* end if */
-
-            /* Insert this chunk into correct location in hash table */
-            rdcc->slot[ent->idx] = ent;
-
-            /* If this chunk was previously on the temporary list and therefore
-             * not in the hash table, remove it from the temporary list.
-             * Otherwise clear the old hash table slot. */
-            if(ent->tmp_prev) {
-                HDassert(tmp_head.tmp_next);
-                HDassert(tmp_tail != &tmp_head);
-                ent->tmp_prev->tmp_next = ent->tmp_next;
-                if(ent->tmp_next) {
-                    ent->tmp_next->tmp_prev = ent->tmp_prev;
-                    ent->tmp_next = NULL;
-                } /* end if */
-                else {
-                    HDassert(tmp_tail == ent);
-                    tmp_tail = ent->tmp_prev;
-                } /* end else */
-                ent->tmp_prev = NULL;
-            } /* end if */
-            else
-                rdcc->slot[old_idx] = NULL;
-        } /* end if */
-    } /* end for */
-
-    /* tmp_tail is no longer needed, and will be invalidated by
-     * H5D_chunk_cache_evict anyways. */
-    tmp_tail = NULL;
-
-    /* Evict chunks that are still on the temporary list */
-    while(tmp_head.tmp_next) {
-        ent = tmp_head.tmp_next;
-
-        /* Remove the old entry from the cache */
-        if(H5D__chunk_cache_evict(dset, dxpl_id, dxpl_cache, ent, TRUE) < 0)
-            HGOTO_ERROR(H5E_IO, H5E_CANTFLUSH, FAIL, "unable to flush one or more raw data chunks")
-    } /* end while */
+    /* The hash values of the cached chunks depend on the scaled dimension
+     * sizes, so rebuild the hash table in place.  Chunks no longer compete
+     * for slots, so none have to be evicted.
+     */
+    if(rdcc->slot)
+        if(H5D__chunk_cache_rehash(dset->shared, rdcc->slot_nalloc) < 0)
+            HGOTO_ERROR(H5E_DATASET, H5E_CANTRESIZE, FAIL, "unable to rebuild chunk cache hash table")
+    if(rdcc->ghost_slot)
+        H5D__chunk_cache_ghost_rehash(dset->shared);
 
 done:
-    /* Remove temporary list from rdcc */
-    rdcc->tmp_head = NULL;
-
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_update_cache() */
 
@@ -5724,26 +8249,15 @@ H5D__chunk_copy_cb(const H5D_chunk_rec_t *chunk_rec, void *_udata)
     else {
         H5D_rdcc_ent_t *ent = NULL;    /* Cache entry */
         unsigned idx;                   /* Index of chunk in cache, if present */
-        unsigned u;                     /* Counter */
         H5D_shared_t *shared_fo = (H5D_shared_t *)udata->cpy_info->shared_fo;
 
         /* See if the written chunk is in the chunk cache */
         if(shared_fo && shared_fo->cache.chunk.nslots > 0) {
             /* Determine the chunk's location in the hash table */
-            idx = H5D__chunk_hash_val(shared_fo, chunk_rec->scaled);
-
-            /* Get the chunk cache entry for that location */
-            ent = shared_fo->cache.chunk.slot[idx];
-            if(ent) {
-                /* Speculatively set the 'found' flag */
+            idx = H5D__chunk_cache_find(shared_fo, chunk_rec->scaled);
+            if(UINT_MAX != idx) {
+                ent = shared_fo->cache.chunk.slot[idx];
                 udata->chunk_in_cache = TRUE;
-
-                /* Verify that the cache entry is the correct chunk */
-                for(u = 0; u < shared_fo->ndims; u++)
-                    if(chunk_rec->scaled[u] != ent->scaled[u]) {
-                        udata->chunk_in_cache = FALSE;
-                        break;
-                    } /* end if */
             } /* end if */
         } /* end if */
 
@@ -6395,6 +8909,28 @@ H5D__chunk_stats(const H5D_t *dset, hbool_t headers)
         fprintf(H5DEBUG(AC), "   %-18s %8u %8u %7s %8d+%-9ld\n",
             "raw data chunks", rdcc->stats.nhits, rdcc->stats.nmisses, ascii,
             rdcc->stats.ninits, (long)(rdcc->stats.nflushes)-(long)(rdcc->stats.ninits));
+        if(rdcc->shared_cache)
+            fprintf(H5DEBUG(AC), "   %-18s %8u preempted by other datasets, file-wide %lu/%lu bytes in %lu chunks\n",
+                "shared chunk cache", rdcc->stats.nshared_evicts,
+                (unsigned long)rdcc->shared_cache->nbytes_used,
+                (unsigned long)rdcc->shared_cache->nbytes_max,
+                (unsigned long)rdcc->shared_cache->nused);
+        if(rdcc->prefetch_nchunks > 0)
+            fprintf(H5DEBUG(AC), "   %-18s %8u hits on %u chunks read ahead\n",
+                "chunk read-ahead", rdcc->stats.nprefetch_hits, rdcc->stats.nprefetches);
+        if(rdcc->cinfo_nbytes_max > 0) {
+            if(rdcc->stats.ncinfo_hits > 0 || rdcc->stats.ncinfo_misses > 0)
+                miss_rate = 100.0 * rdcc->stats.ncinfo_misses /
+                        (rdcc->stats.ncinfo_hits + rdcc->stats.ncinfo_misses);
+            else
+                miss_rate = 0.0;
+            sprintf(ascii, "%7.2f%%", miss_rate);
+            fprintf(H5DEBUG(AC), "   %-18s %8u %8u %7s %lu/%lu entries, %lu/%lu bytes\n",
+                "chunk addresses", rdcc->stats.ncinfo_hits, rdcc->stats.ncinfo_misses, ascii,
+                (unsigned long)rdcc->cinfo_nused, (unsigned long)rdcc->cinfo_nalloc,
+                (unsigned long)(rdcc->cinfo_nalloc * sizeof(H5D_chunk_cinfo_ent_t)),
+                (unsigned long)rdcc->cinfo_nbytes_max);
+        } /* end if */
     }
 
 done:
@@ -6563,6 +9099,36 @@ done:
 herr_t
 H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
     H5F_block_t *new_chunk, hbool_t *need_insert, hsize_t scaled[])
+{
+    herr_t ret_value = SUCCEED;   	/* Return value         */
+
+    FUNC_ENTER_PACKAGE
+
+    if(H5D__chunk_file_alloc_real(idx_info, old_chunk, new_chunk, need_insert, scaled, NULL) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "unable to allocate chunk")
+
+done: 
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* H5D__chunk_file_alloc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5D__chunk_file_alloc_real()
+ *
+ * Purpose:     Does the work for H5D__chunk_file_alloc().  If RESERVE is
+ *              not NULL, space for a new chunk is taken from the start of
+ *              the block it describes, which was allocated beforehand,
+ *              instead of being allocated on its own, and the space of an
+ *              old chunk that is reallocated is not released: the caller
+ *              releases it once the index points to the new chunk.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5D__chunk_file_alloc_real(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old_chunk,
+    H5F_block_t *new_chunk, hbool_t *need_insert, hsize_t scaled[], H5F_block_t *reserve)
 {
     hbool_t alloc_chunk = FALSE;	/* Whether to allocate chunk */
     herr_t ret_value = SUCCEED;   	/* Return value         */
@@ -6616,7 +9182,7 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
                  * we must keep the old chunk around in case a reader has an
                  * outdated version of the B-tree node
                  */
-		if(!(H5F_INTENT(idx_info->f) & H5F_ACC_SWMR_WRITE))
+		if(!reserve && !(H5F_INTENT(idx_info->f) & H5F_ACC_SWMR_WRITE))
 		    if(H5MF_xfree(idx_info->f, H5FD_MEM_DRAW, idx_info->dxpl_id, old_chunk->offset, old_chunk->length) < 0)
 			HGOTO_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "unable to free chunk")
 		alloc_chunk = TRUE;
@@ -6660,9 +9226,17 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
             case H5D_CHUNK_IDX_SINGLE:
                 HDassert(new_chunk->length > 0);
                 H5_CHECK_OVERFLOW(new_chunk->length, /*From: */uint32_t, /*To: */hsize_t);
-                new_chunk->offset = H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, idx_info->dxpl_id, (hsize_t)new_chunk->length);
-                if(!H5F_addr_defined(new_chunk->offset))
-                    HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+                if(reserve) {
+                    HDassert(reserve->length >= new_chunk->length);
+                    new_chunk->offset = reserve->offset;
+                    reserve->offset += new_chunk->length;
+                    reserve->length -= new_chunk->length;
+                } /* end if */
+                else {
+                    new_chunk->offset = H5MF_alloc(idx_info->f, H5FD_MEM_DRAW, idx_info->dxpl_id, (hsize_t)new_chunk->length);
+                    if(!H5F_addr_defined(new_chunk->offset))
+                        HGOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "file allocation failed")
+                } /* end else */
                 *need_insert = TRUE;
                 break;
 
@@ -6677,7 +9251,7 @@ H5D__chunk_file_alloc(const H5D_chk_idx_info_t *idx_info, const H5F_block_t *old
 
 done: 
     FUNC_LEAVE_NOAPI(ret_value)
-} /* H5D__chunk_file_alloc() */
+} /* H5D__chunk_file_alloc_real() */
 
 
 /*-------------------------------------------------------------------------
@@ -6810,6 +9384,9 @@ H5D__chunk_format_convert(H5D_t *dset, H5D_chk_idx_info_t *idx_info, H5D_chk_idx
     if((idx_info->storage->ops->iterate)(idx_info, H5D__chunk_format_convert_cb, &udata) < 0)
 	HGOTO_ERROR(H5E_DATASET, H5E_BADITER, FAIL, "unable to iterate over chunk index to chunk info")
 
+    /* Chunks may have moved, and their index in the new chunk index differs */
+    H5D__chunk_cinfo_cache_reset(&dset->shared->cache.chunk);
+
 done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5D__chunk_format_convert() */
@@ -322,13 +322,6 @@ H5D__extend(H5D_t *dataset, const hsize_t *size, hid_t dxpl_id)
                         /* Update the scaled dimension size value for the current dimension */
                         dataset->shared->cache.chunk.scaled_dims[u] = scaled;
 
-                        /* Check if algorithm for computing hash values will change */
-                        if((scaled > dataset->shared->cache.chunk.nslots &&
-                                    dataset->shared->cache.chunk.scaled_dims[u] <= dataset->shared->cache.chunk.nslots)
-                                || (scaled <= dataset->shared->cache.chunk.nslots &&
-                                    dataset->shared->cache.chunk.scaled_dims[u] > dataset->shared->cache.chunk.nslots))
-                            update_chunks = TRUE;
-
                         if( !(scaled_power2up = H5VM_power2up(scaled)) )
                             HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get the next power of 2")
 
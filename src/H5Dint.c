@@ -355,6 +355,10 @@ H5D__get_dxpl_cache_real(hid_t dxpl_id, H5D_dxpl_cache_t *cache)
     if(H5P_get(dx_plist, H5D_XFER_HYPER_VECTOR_SIZE_NAME, &cache->vec_size) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "Can't retrieve I/O vector size")
 
+    /* Get number of threads for chunk filters */
+    if(H5P_get(dx_plist, H5D_XFER_FILTER_NTHREADS_NAME, &cache->filter_nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "Can't retrieve number of filter threads")
+
 #ifdef H5_HAVE_PARALLEL
     /* Collect Parallel I/O information for possible later use */
     if(H5P_get(dx_plist, H5D_XFER_IO_XFER_MODE_NAME, &cache->xfer_mode) < 0)
@@ -1896,6 +1900,11 @@ H5D_close(H5D_t *dataset)
 
     } /* end if */
     else {
+        /* Stop flushing cached chunks through this handle */
+        if(H5D_CHUNKED == dataset->shared->layout.type)
+            if(H5D__chunk_owner_close(dataset, H5AC_ind_read_dxpl_id) < 0)
+                HGOTO_ERROR(H5E_DATASET, H5E_CANTFLUSH, FAIL, "unable to flush cached chunks")
+
         /* Decrement the ref. count for this object in the top file */
         if(H5FO_top_decr(dataset->oloc.file, dataset->oloc.addr) < 0)
             HGOTO_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "can't decrement count for object")
@@ -2705,13 +2714,6 @@ H5D__set_extent(H5D_t *dset, const hsize_t *size, hid_t dxpl_id)
                     /* Update the scaled dimension size value for the current dimension */
                     dset->shared->cache.chunk.scaled_dims[u] = scaled;
 
-                    /* Check if algorithm for computing hash values will change */
-                    if((scaled > dset->shared->cache.chunk.nslots &&
-                                dset->shared->cache.chunk.scaled_dims[u] <= dset->shared->cache.chunk.nslots)
-                            || (scaled <= dset->shared->cache.chunk.nslots &&
-                                dset->shared->cache.chunk.scaled_dims[u] > dset->shared->cache.chunk.nslots))
-                        update_chunks = TRUE;
-
                     if(!(scaled_power2up = H5VM_power2up(scaled)))
                         HGOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "unable to get the next power of 2")
 
@@ -3376,6 +3378,14 @@ H5D_get_access_plist(H5D_t *dset)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set data cache byte size")
         if(H5P_set(new_plist, H5D_ACS_PREEMPT_READ_CHUNKS_NAME, &(dset->shared->cache.chunk.w0)) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set preempt read chunks")
+        if(H5P_set(new_plist, H5D_ACS_DATA_CACHE_POLICY_NAME, &(dset->shared->cache.chunk.policy)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk cache replacement policy")
+        if(H5P_set(new_plist, H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_NAME, &(dset->shared->cache.chunk.filter_nthreads)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set number of chunk write back threads")
+        if(H5P_set(new_plist, H5D_ACS_DATA_CACHE_PREFETCH_NAME, &(dset->shared->cache.chunk.prefetch_nchunks)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk read-ahead")
+        if(H5P_set(new_plist, H5D_ACS_DATA_CACHE_CINFO_NBYTES_NAME, &(dset->shared->cache.chunk.cinfo_nbytes_max)) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk address cache size")
         if(H5P_set(new_plist, H5D_ACS_APPEND_FLUSH_NAME, &dset->shared->append_flush) < 0)
             HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set append flush property")
     } /* end if */
@@ -220,6 +220,88 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dread() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dread_chunks
+ *
+ * Purpose:	Reads several raw chunks of a chunked dataset directly from
+ *		the file, bypassing the filter pipeline and datatype
+ *		conversion.  OFFSETS holds the logical offsets of the
+ *		NCHUNKS chunks, one after another, each with as many values
+ *		as the dataset's rank and on a chunk boundary.
+ *
+ *		The filter mask of each chunk is returned in FILTERS and
+ *		its stored size in CHUNK_NBYTES, either of which may be
+ *		NULL.  Unless BUFS is NULL, BUFS[i] must point to a buffer
+ *		large enough for chunk i, into which the stored chunk is
+ *		read.  Chunks that haven't been written yet are returned
+ *		with a size of zero and their buffers are left alone.
+ *
+ *		Reading the chunks in one call lets the library look them
+ *		up together and read them in file order, combining reads of
+ *		chunks that are next to each other in the file.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t nchunks,
+    const hsize_t *offsets, uint32_t *filters/*out*/,
+    hsize_t *chunk_nbytes/*out*/, void **bufs/*out*/)
+{
+    H5D_t      *dset = NULL;
+    size_t      u;                      /* Local index variable */
+    unsigned    v;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiz*hxxx", dset_id, dxpl_id, nchunks, offsets, filters,
+             chunk_nbytes, bufs);
+
+    /* check arguments */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(NULL == dset->oloc.file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    if(nchunks > 0 && !offsets)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no chunk offsets")
+    if(bufs)
+        for(u = 0; u < nchunks; u++)
+            if(!bufs[u])
+                HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no output buffer")
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Check the offsets, as for a direct chunk read with H5Dread() */
+    for(u = 0; u < nchunks; u++)
+        for(v = 0; v < dset->shared->ndims; v++) {
+            hsize_t off = offsets[u * dset->shared->ndims + v];
+
+            /* Make sure the offset doesn't exceed the dataset's dimensions */
+            if(off > dset->shared->curr_dims[v])
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "offset exceeds dimensions of dataset")
+
+            /* Make sure the offset fall right on a chunk's boundary */
+            if(off % dset->shared->layout.u.chunk.dim[v])
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "offset doesn't fall on chunks's boundary")
+        } /* end for */
+
+    /* Read the raw chunks */
+    if(H5D__chunk_direct_read_multi(dset, dxpl_id, nchunks, offsets, filters, chunk_nbytes, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read chunks directly")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dread_chunks() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	H5Dwrite
@@ -318,6 +400,93 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Dwrite() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Dwrite_chunks
+ *
+ * Purpose:	Writes several raw chunks of a chunked dataset directly into
+ *		the file, bypassing the filter pipeline and datatype
+ *		conversion.  OFFSETS holds the logical offsets of the
+ *		NCHUNKS chunks, one after another, each with as many values
+ *		as the dataset's rank and on a chunk boundary.  A chunk may
+ *		only be written once per call.  Chunk i has the filter mask
+ *		FILTERS[i], and its CHUNK_NBYTES[i] bytes are in BUFS[i].
+ *
+ *		Writing the chunks in one call lets the library allocate
+ *		the file space for all of them at once, write them in file
+ *		order, combining writes of chunks that are next to each
+ *		other in the file, and insert them into the chunk index in
+ *		order.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Dwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t nchunks,
+    const hsize_t *offsets, const uint32_t *filters,
+    const hsize_t *chunk_nbytes, const void **bufs)
+{
+    H5D_t      *dset = NULL;
+    size_t      u;                      /* Local index variable */
+    unsigned    v;                      /* Local index variable */
+    herr_t      ret_value = SUCCEED;    /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE7("e", "iiz*h*Iu*h**x", dset_id, dxpl_id, nchunks, offsets, filters,
+             chunk_nbytes, bufs);
+
+    /* check arguments */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(dset_id, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    if(NULL == dset->oloc.file)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "dataset is not associated with a file")
+    if(H5D_CHUNKED != dset->shared->layout.type)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a chunked dataset")
+    if(0 == (H5F_INTENT(dset->oloc.file) & H5F_ACC_RDWR))
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "no write intent on file")
+    if(nchunks > 0 && (!offsets || !filters || !chunk_nbytes || !bufs))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no chunk offsets, filter masks, sizes or buffers")
+    for(u = 0; u < nchunks; u++) {
+        if(!bufs[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "no chunk data")
+        if(!chunk_nbytes[u])
+            HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk size is zero")
+
+        /* Chunk sizes are limited to 32-bits currently */
+        if(chunk_nbytes[u] != (hsize_t)((uint32_t)chunk_nbytes[u]))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "chunk size must be < 4GB")
+    } /* end for */
+
+    /* Get the default dataset transfer property list if the user didn't provide one */
+    if(H5P_DEFAULT == dxpl_id)
+        dxpl_id = H5P_DATASET_XFER_DEFAULT;
+    else
+        if(TRUE != H5P_isa_class(dxpl_id, H5P_DATASET_XFER))
+            HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not xfer parms")
+
+    /* Check the offsets, as for a direct chunk write with H5Dwrite() */
+    for(u = 0; u < nchunks; u++)
+        for(v = 0; v < dset->shared->ndims; v++) {
+            hsize_t off = offsets[u * dset->shared->ndims + v];
+
+            /* Make sure the offset doesn't exceed the dataset's dimensions */
+            if(off > dset->shared->curr_dims[v])
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "offset exceeds dimensions of dataset")
+
+            /* Make sure the offset fall right on a chunk's boundary */
+            if(off % dset->shared->layout.u.chunk.dim[v])
+                HGOTO_ERROR(H5E_DATASPACE, H5E_BADTYPE, FAIL, "offset doesn't fall on chunks's boundary")
+        } /* end for */
+
+    /* Write the raw chunks */
+    if(H5D__chunk_direct_write_multi(dset, dxpl_id, nchunks, offsets, filters, chunk_nbytes, bufs) < 0)
+        HGOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write chunks directly")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Dwrite_chunks() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5D__pre_write
@@ -352,6 +352,21 @@ typedef struct H5D_chunk_info_t {
     hbool_t mspace_shared;      /* Indicate that the memory space for a chunk is shared and shouldn't be freed */
 } H5D_chunk_info_t;
 
+/* Regular hyperslab selection in one dimension of the file and memory, for
+ * chunk maps that work out the selection in each chunk when it's visited
+ */
+typedef struct H5D_chunk_reg_dim_t {
+    hsize_t start;              /* Offset of first block in file */
+    hsize_t stride;             /* Distance between blocks in file */
+    hsize_t count;              /* Number of blocks */
+    hsize_t block;              /* Size of blocks */
+    hsize_t mstart;             /* Offset of first block in memory */
+    hsize_t mstride;            /* Distance between blocks in memory */
+    hsize_t first_scaled;       /* Scaled coordinate of first chunk selected */
+    hsize_t scaled_step;        /* Distance between chunks selected */
+    hsize_t nchunks;            /* Number of chunks selected */
+} H5D_chunk_reg_dim_t;
+
 /* Main structure holding the mapping between file chunks and memory */
 typedef struct H5D_chunk_map_t {
     H5O_layout_t *layout;       /* Dataset layout information*/
@@ -373,6 +388,10 @@ typedef struct H5D_chunk_map_t {
     H5D_chunk_info_t *single_chunk_info;  /* Pointer to single chunk's info */
     hbool_t use_single;         /* Whether I/O is on a single element */
 
+    hbool_t use_regular;        /* Whether chunk selections are worked out as the chunks are visited */
+    H5D_chunk_reg_dim_t reg_dim[H5O_LAYOUT_NDIMS];  /* Regular selection in each dimension */
+    hsize_t reg_nchunks;        /* Number of chunks selected */
+
     hsize_t last_index;         /* Index of last chunk operated on */
     H5D_chunk_info_t *last_chunk_info;  /* Pointer to last chunk's info */
 
@@ -393,6 +412,17 @@ typedef struct H5D_chunk_cached_t {
     unsigned    filter_mask;           /*excluded filters */
 } H5D_chunk_cached_t;
 
+/* Entry in the chunk address cache, a direct mapped table of the locations
+ * of chunks recently looked up in the chunk index
+ */
+typedef struct H5D_chunk_cinfo_ent_t {
+    hsize_t     key;                   /*linear index of chunk plus one, 0 if unused */
+    haddr_t     addr;                  /*file address of chunk */
+    hsize_t     chunk_idx;             /*index of chunk in dataset */
+    uint32_t    nbytes;                /*size of stored data */
+    unsigned    filter_mask;           /*excluded filters */
+} H5D_chunk_cinfo_ent_t;
+
 /****************************/
 /* Virtual dataset typedefs */
 /****************************/
@@ -403,29 +433,97 @@ typedef struct H5D_virtual_held_file_t {
     struct H5D_virtual_held_file_t *next;       /* Pointer to next node in list */
 } H5D_virtual_held_file_t;
 
-/* The raw data chunk cache */
 struct H5D_rdcc_ent_t;  /* Forward declaration of struct used below */
+
+/* A chunk buffer passed through the I/O filter pipeline outside of
+ * H5D__chunk_lock() and H5D__chunk_flush_entry(), so that several chunks
+ * can be filtered at once */
+typedef struct H5D_chunk_filt_t {
+    struct H5D_rdcc_ent_t *ent;         /* Cache entry being written back (NULL when reading) */
+    hsize_t     scaled[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of chunk */
+    haddr_t     addr;                   /* Address of chunk in file */
+    void        *buf;                   /* Chunk buffer */
+    size_t      nbytes;                 /* Number of valid bytes in buffer */
+    size_t      buf_alloc;              /* Allocated size of buffer */
+    unsigned    filter_mask;            /* Excluded filters */
+    herr_t      status;                 /* Result of the filter pipeline */
+} H5D_chunk_filt_t;
+
+/* The raw data chunk cache */
 typedef struct H5D_rdcc_t {
     struct {
         unsigned    ninits;    /* Number of chunk creations        */
         unsigned    nhits;     /* Number of cache hits            */
         unsigned    nmisses;   /* Number of cache misses        */
         unsigned    nflushes;  /* Number of cache flushes        */
+        unsigned    nshared_evicts; /* Number of chunks preempted by other datasets in the file-wide cache */
+        unsigned    nprefetches; /* Number of chunks read ahead    */
+        unsigned    nprefetch_hits; /* Number of hits on chunks read ahead */
+        unsigned    ncinfo_hits; /* Number of chunk address cache hits */
+        unsigned    ncinfo_misses; /* Number of chunk address cache misses */
     } stats;
     size_t        nbytes_max;  /* Maximum cached raw data in bytes    */
-    size_t        nslots;      /* Number of chunk slots allocated    */
+    size_t        nslots;      /* Number of chunk slots requested (0 disables the cache) */
     double        w0;          /* Chunk preemption policy          */
+    H5D_chunk_cache_policy_t policy; /* Chunk replacement policy     */
     struct H5D_rdcc_ent_t *head; /* Head of doubly linked list        */
     struct H5D_rdcc_ent_t *tail; /* Tail of doubly linked list        */
-    struct H5D_rdcc_ent_t *tmp_head; /* Head of temporary doubly linked list.  Chunks on this list are not in the hash table (slot).  The head entry is a sentinel (does not refer to an actual chunk). */
     size_t        nbytes_used;  /* Current cached raw data in bytes */
     int           nused;        /* Number of chunk slots in use        */
     H5D_chunk_cached_t last;    /* Cached copy of last chunk information */
-    struct H5D_rdcc_ent_t **slot; /* Chunk slots, each points to a chunk*/
+    H5D_chunk_cinfo_ent_t *cinfo; /* Chunk address cache, allocated on first use */
+    size_t        cinfo_nalloc; /* Number of entries in address cache (a power of two) */
+    unsigned      cinfo_nbits;  /* log2(cinfo_nalloc) */
+    size_t        cinfo_nused;  /* Number of address cache entries in use */
+    size_t        cinfo_nbytes_max; /* Maximum size of address cache in bytes (0 disables it) */
+    struct H5D_rdcc_ent_t **slot; /* Open addressing hash table, each slot points to a chunk */
+    size_t        slot_nalloc;  /* Number of slots in hash table (a power of two) */
+    unsigned      slot_nbits;   /* log2(slot_nalloc) */
+    size_t        slot_ndeleted; /* Number of slots marked deleted */
     H5SL_t        *sel_chunks;    /* Skip list containing information for each chunk selected */
     H5S_t         *single_space;  /* Dataspace for single element I/O on chunks */
     H5D_chunk_info_t    *single_chunk_info;  /* Pointer to single chunk's info */
 
+    /* 2Q replacement policy state.  Entries that have been accessed once
+     * are on the probationary (A1in) queue, entries that were accessed again
+     * after being preempted from it are on the protected (Am) queue; both
+     * queues share the doubly linked list above.  The scaled coordinates of
+     * the most recently preempted probationary entries are remembered in a
+     * ring of 'ghosts' (A1out), which is indexed by a hash table keyed like
+     * the chunk slots.
+     */
+    int           nprobation;   /* Number of entries on the probationary queue */
+    size_t        nghosts_max;  /* Number of ghosts that fit in the ring */
+    size_t        nghosts;      /* Number of ghosts recorded */
+    size_t        ghost_next;   /* Index of next ghost to overwrite */
+    hsize_t       *ghost;       /* Ghost ring, 'ndims' scaled coordinates per ghost */
+    size_t        *ghost_slot;  /* Hash table of ghosts: index in the ring + 1, or 0 if empty */
+    size_t        ghost_nslots; /* Number of slots in the ghost hash table (a power of two) */
+    unsigned      ghost_nbits;  /* log2(ghost_nslots) */
+
+    /* Chunks read and unfiltered ahead of the H5D__chunk_lock() call that
+     * needs them (see H5Pset_filter_nthreads) */
+    H5D_chunk_filt_t    *staged;        /* Staged chunks, buffers are NULL once taken */
+    size_t              nstaged;        /* Number of staged chunks */
+    size_t              staged_nalloc;  /* Number of staged chunks allocated */
+    unsigned            filter_nthreads; /* Number of threads filtering dirty chunks
+                                         * when they are written back (see
+                                         * H5Pset_chunk_flush_nthreads) */
+
+    /* Read-ahead state.  The scaled coordinates of the chunks read are
+     * compared with those of the previous chunk; once the same stride was
+     * seen twice in a row, reads read the next chunks along it ahead.
+     */
+    size_t        prefetch_nchunks; /* Number of chunks to read ahead (0 disables) */
+    unsigned      prefetch_nrun; /* Number of chunks read along the current stride */
+    hsize_t       prefetch_last[H5O_LAYOUT_NDIMS]; /* Scaled coordinates of last chunk read */
+    hssize_t      prefetch_stride[H5O_LAYOUT_NDIMS]; /* Current stride, in scaled coordinates */
+    hbool_t       prefetching;  /* Whether chunks being locked are read ahead */
+
+    /* File-wide shared chunk cache participation */
+    H5F_rdcc_shared_t   *shared_cache;  /* File-wide cache this dataset's chunks count against (NULL if private) */
+    const H5D_t         *owner;         /* Open handle of the dataset, for flushing its chunks when other datasets preempt them */
+
     /* Cached information about scaled dataspace dimensions */
     hsize_t             scaled_dims[H5S_MAX_RANK];          /* The scaled dim sizes */
     hsize_t             scaled_power2up[H5S_MAX_RANK];      /* The scaled dim sizes, rounded up to next power of 2 */
@@ -667,6 +765,7 @@ H5_DLL htri_t H5D__chunk_cacheable(const H5D_io_info_t *io_info, haddr_t caddr,
     hbool_t write_op);
 H5_DLL herr_t H5D__chunk_create(const H5D_t *dset /*in,out*/, hid_t dxpl_id);
 H5_DLL herr_t H5D__chunk_set_info(const H5D_t *dset);
+H5_DLL herr_t H5D__chunk_cinfo_cache_reset(H5D_rdcc_t *rdcc);
 H5_DLL hbool_t H5D__chunk_is_space_alloc(const H5O_storage_t *storage);
 H5_DLL herr_t H5D__chunk_lookup(const H5D_t *dset, hid_t dxpl_id,
     const hsize_t *scaled, H5D_chunk_ud_t *udata);
@@ -683,6 +782,7 @@ H5_DLL herr_t H5D__chunk_set_sizes(H5D_t *dset);
 H5_DLL herr_t H5D__chunk_addrmap(const H5D_io_info_t *io_info, haddr_t chunk_addr[]);
 #endif /* H5_HAVE_PARALLEL */
 H5_DLL herr_t H5D__chunk_update_cache(H5D_t *dset, hid_t dxpl_id);
+H5_DLL herr_t H5D__chunk_owner_close(const H5D_t *dset, hid_t dxpl_id);
 H5_DLL herr_t H5D__chunk_copy(H5F_t *f_src, H5O_storage_chunk_t *storage_src,
     H5O_layout_chunk_t *layout_src, H5F_t *f_dst, H5O_storage_chunk_t *storage_dst,
     const H5S_extent_t *ds_extent_src, const H5T_t *dt_src,
@@ -694,6 +794,10 @@ H5_DLL herr_t H5D__chunk_delete(H5F_t *f, hid_t dxpl_id, H5O_t *oh,
     H5O_storage_t *store);
 H5_DLL herr_t H5D__chunk_direct_write(const H5D_t *dset, hid_t dxpl_id, uint32_t filters,
          hsize_t *offset, uint32_t data_size, const void *buf);
+H5_DLL herr_t H5D__chunk_direct_write_multi(const H5D_t *dset, hid_t dxpl_id, size_t nchunks,
+    const hsize_t *offsets, const uint32_t *filters, const hsize_t *nbytes, const void **bufs);
+H5_DLL herr_t H5D__chunk_direct_read_multi(const H5D_t *dset, hid_t dxpl_id, size_t nchunks,
+    const hsize_t *offsets, uint32_t *filters, hsize_t *nbytes, void **bufs);
 H5_DLL herr_t H5D__chunk_direct_read(const H5D_t *dset, hid_t dxpl_id, hsize_t *offset,
          uint32_t *filters, void *buf);
 #ifdef H5D_CHUNK_DEBUG
@@ -788,6 +892,8 @@ H5_DLL herr_t H5D__layout_compact_dirty_test(hid_t did, hbool_t *dirty);
 H5_DLL herr_t H5D__layout_idx_type_test(hid_t did, H5D_chunk_index_t *idx_type);
 H5_DLL herr_t H5D__layout_type_test(hid_t did, H5D_layout_t *layout_type);
 H5_DLL herr_t H5D__current_cache_size_test(hid_t did, size_t *nbytes_used, int *nused);
+H5_DLL herr_t H5D__shared_cache_size_test(hid_t did, size_t *nbytes_used, size_t *nused);
+H5_DLL herr_t H5D__chunk_addr_cache_test(hid_t did, size_t *nused, unsigned *nhits);
 #endif /* H5D_TESTING */
 
 #endif /*_H5Dpkg_H*/
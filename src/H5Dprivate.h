@@ -50,6 +50,10 @@
 #define H5D_ACS_DATA_CACHE_NUM_SLOTS_NAME   "rdcc_nslots"    /* Size of raw data chunk cache(slots) */
 #define H5D_ACS_DATA_CACHE_BYTE_SIZE_NAME   "rdcc_nbytes"    /* Size of raw data chunk cache(bytes) */
 #define H5D_ACS_PREEMPT_READ_CHUNKS_NAME    "rdcc_w0"        /* Preemption read chunks first */
+#define H5D_ACS_DATA_CACHE_POLICY_NAME      "rdcc_policy"    /* Raw data chunk cache replacement policy */
+#define H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_NAME "rdcc_flush_nthreads" /* Number of threads filtering chunks written back */
+#define H5D_ACS_DATA_CACHE_PREFETCH_NAME    "rdcc_prefetch"  /* Number of chunks to read ahead */
+#define H5D_ACS_DATA_CACHE_CINFO_NBYTES_NAME "rdcc_cinfo_nbytes" /* Size of chunk address cache (bytes) */
 #define H5D_ACS_VDS_VIEW_NAME               "vds_view"       /* VDS view option */
 #define H5D_ACS_VDS_PRINTF_GAP_NAME         "vds_printf_gap" /* VDS printf gap size */
 #define H5D_ACS_VDS_PREFIX_NAME             "vds_prefix"     /* VDS file prefix */
@@ -69,6 +73,7 @@
 #define H5D_XFER_VFL_ID_NAME            "vfl_id"        /* File driver ID */
 #define H5D_XFER_VFL_INFO_NAME          "vfl_info"      /* File driver info */
 #define H5D_XFER_HYPER_VECTOR_SIZE_NAME "vec_size"      /* Hyperslab vector size */
+#define H5D_XFER_FILTER_NTHREADS_NAME   "filter_nthreads" /* Number of threads for chunk filters */
 #define H5D_XFER_IO_XFER_MODE_NAME      "io_xfer_mode"  /* I/O transfer mode */
 #define H5D_XFER_MPIO_COLLECTIVE_OPT_NAME "mpio_collective_opt" /* Optimization of MPI-IO transfer mode */
 #define H5D_XFER_MPIO_CHUNK_OPT_HARD_NAME "mpio_chunk_opt_hard"
@@ -129,6 +134,7 @@ typedef struct H5D_dxpl_cache_t {
     H5Z_EDC_t err_detect;       /* Error detection info (H5D_XFER_EDC_NAME) */
     double btree_split_ratio[3];/* B-tree split ratios (H5D_XFER_BTREE_SPLIT_RATIO_NAME) */
     size_t vec_size;            /* Size of hyperslab vector (H5D_XFER_HYPER_VECTOR_SIZE_NAME) */
+    unsigned filter_nthreads;   /* Number of threads for chunk filters (H5D_XFER_FILTER_NTHREADS_NAME) */
 #ifdef H5_HAVE_PARALLEL
     H5FD_mpio_xfer_t xfer_mode; /* Parallel transfer for this request (H5D_XFER_IO_XFER_MODE_NAME) */
     H5FD_mpio_collective_opt_t coll_opt_mode; /* Parallel transfer with independent IO or collective IO with this mode */
@@ -105,6 +105,13 @@ typedef enum H5D_fill_value_t {
     H5D_FILL_VALUE_USER_DEFINED =2
 } H5D_fill_value_t;
 
+/* Values for the raw data chunk cache replacement policy */
+typedef enum H5D_chunk_cache_policy_t {
+    H5D_CHUNK_CACHE_POLICY_ERROR = -1,
+    H5D_CHUNK_CACHE_POLICY_LRU   = 0,   /* LRU, with w0 preemption of fully read/written chunks (default) */
+    H5D_CHUNK_CACHE_POLICY_2Q    = 1    /* Scan-resistant 2Q replacement */
+} H5D_chunk_cache_policy_t;
+
 /* Values for VDS bounds option */
 typedef enum H5D_vds_view_t {
     H5D_VDS_ERROR               = -1,
@@ -157,6 +164,12 @@ H5_DLL herr_t H5Dread(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			hid_t file_space_id, hid_t plist_id, void *buf/*out*/);
 H5_DLL herr_t H5Dwrite(hid_t dset_id, hid_t mem_type_id, hid_t mem_space_id,
 			 hid_t file_space_id, hid_t plist_id, const void *buf);
+H5_DLL herr_t H5Dwrite_chunks(hid_t dset_id, hid_t dxpl_id, size_t nchunks,
+            const hsize_t *offsets, const uint32_t *filters,
+            const hsize_t *chunk_nbytes, const void **bufs);
+H5_DLL herr_t H5Dread_chunks(hid_t dset_id, hid_t dxpl_id, size_t nchunks,
+            const hsize_t *offsets, uint32_t *filters/*out*/,
+            hsize_t *chunk_nbytes/*out*/, void **bufs/*out*/);
 H5_DLL herr_t H5Diterate(void *buf, hid_t type_id, hid_t space_id,
             H5D_operator_t op, void *operator_data);
 H5_DLL herr_t H5Dvlen_reclaim(hid_t type_id, hid_t space_id, hid_t plist_id, void *buf);
@@ -308,3 +308,94 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 }   /* H5D__current_cache_size_test() */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__shared_cache_size_test
+ PURPOSE
+    Determine the current size of the file-wide shared chunk cache that a
+    dataset participates in
+ USAGE
+    herr_t H5D__shared_cache_size_test(did, nbytes_used, nused)
+        hid_t did;              IN: Dataset to query
+        size_t *nbytes_used;    OUT: Bytes cached for all datasets in the file
+        size_t *nused;          OUT: Chunks cached for all datasets in the file
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Retrieves the usage of the shared chunk cache.  Both values are zero if
+    the dataset doesn't use a file-wide shared chunk cache.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__shared_cache_size_test(hid_t did, size_t *nbytes_used, size_t *nused)
+{
+    H5D_t	*dset;          /* Pointer to dataset to query */
+    const H5F_rdcc_shared_t *sc;  /* File-wide shared chunk cache */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    HDassert(dset->shared->layout.type == H5D_CHUNKED);
+
+    sc = dset->shared->cache.chunk.shared_cache;
+    if(nbytes_used)
+        *nbytes_used = sc ? sc->nbytes_used : 0;
+    if(nused)
+        *nused = sc ? sc->nused : 0;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5D__shared_cache_size_test() */
+
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5D__chunk_addr_cache_test
+ PURPOSE
+    Determine the usage of a dataset's chunk address cache
+ USAGE
+    herr_t H5D__chunk_addr_cache_test(did, nused, nhits)
+        hid_t did;              IN: Dataset to query
+        size_t *nused;          OUT: Chunk addresses in the cache
+        unsigned *nhits;        OUT: Chunk lookups answered from the cache
+ RETURNS
+    Non-negative on success, negative on failure
+ DESCRIPTION
+    Retrieves the number of entries in use in the chunk address cache and
+    the number of times it was hit since the dataset was opened.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    DO NOT USE THIS FUNCTION FOR ANYTHING EXCEPT TESTING
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+herr_t
+H5D__chunk_addr_cache_test(hid_t did, size_t *nused, unsigned *nhits)
+{
+    H5D_t	*dset;          /* Pointer to dataset to query */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_PACKAGE
+
+    /* Check args */
+    if(NULL == (dset = (H5D_t *)H5I_object_verify(did, H5I_DATASET)))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset")
+    HDassert(dset->shared->layout.type == H5D_CHUNKED);
+
+    if(nused)
+        *nused = dset->shared->cache.chunk.cinfo_nused;
+    if(nhits)
+        *nhits = dset->shared->cache.chunk.stats.ncinfo_hits;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+}   /* H5D__chunk_addr_cache_test() */
+
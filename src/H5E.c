@@ -389,6 +389,38 @@ H5E_get_stack(void)
     /* Set return value */
     FUNC_LEAVE_NOAPI(estack)
 } /* end H5E_get_stack() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5E_discard_thread_errors
+ *
+ * Purpose:	Makes the errors pushed by the calling thread be dropped.
+ *		For threads the library starts itself, which run while
+ *		another thread holds the library lock: pushing an error
+ *		changes the reference counts of the error class and message
+ *		IDs, which is only safe under that lock.  The thread's stack
+ *		is marked full, so H5E_push_stack() forgets every error.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5E_discard_thread_errors(void)
+{
+    H5E_t *estack;              /* The calling thread's error stack */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    if(NULL == (estack = H5E_get_my_stack()))
+        HGOTO_DONE(FAIL)
+    HDassert(0 == estack->nused);
+    estack->nused = H5E_NSLOTS;
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5E_discard_thread_errors() */
 #endif  /* H5_HAVE_THREADSAFE */
 
 
@@ -187,6 +187,9 @@ H5_DLL herr_t H5E_printf_stack(H5E_t *estack, const char *file, const char *func
     unsigned line, hid_t cls_id, hid_t maj_id, hid_t min_id, const char *fmt, ...)H5_ATTR_FORMAT(printf, 8, 9);
 H5_DLL herr_t H5E_clear_stack(H5E_t *estack);
 H5_DLL herr_t H5E_dump_api_stack(hbool_t is_api);
+#ifdef H5_HAVE_THREADSAFE
+H5_DLL herr_t H5E_discard_thread_errors(void);
+#endif /* H5_HAVE_THREADSAFE */
 
 #endif /* _H5Eprivate_H */
 
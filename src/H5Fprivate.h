@@ -309,6 +309,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_RDCC_NSLOTS(F)      ((F)->shared->rdcc_nslots)
 #define H5F_RDCC_NBYTES(F)      ((F)->shared->rdcc_nbytes)
 #define H5F_RDCC_W0(F)          ((F)->shared->rdcc_w0)
+#define H5F_RDCC_SHARED(F)      (&(F)->shared->rdcc_shared)
 #define H5F_SIEVE_BUF_SIZE(F)   ((F)->shared->sieve_buf_size)
 #define H5F_GC_REF(F)           ((F)->shared->gc_ref)
 #define H5F_USE_LATEST_FLAGS(F,FL)  ((F)->shared->latest_flags & (FL))
@@ -366,6 +367,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_RDCC_NSLOTS(F)      (H5F_rdcc_nslots(F))
 #define H5F_RDCC_NBYTES(F)      (H5F_rdcc_nbytes(F))
 #define H5F_RDCC_W0(F)          (H5F_rdcc_w0(F))
+#define H5F_RDCC_SHARED(F)      (H5F_rdcc_shared(F))
 #define H5F_SIEVE_BUF_SIZE(F)   (H5F_sieve_buf_size(F))
 #define H5F_GC_REF(F)           (H5F_gc_ref(F))
 #define H5F_USE_LATEST_FLAGS(F,FL) (H5F_use_latest_flags(F,FL))
@@ -472,6 +474,7 @@ typedef struct H5F_t H5F_t;
 #define H5F_ACS_DATA_CACHE_NUM_SLOTS_NAME       "rdcc_nslots"   /* Size of raw data chunk cache(slots) */
 #define H5F_ACS_DATA_CACHE_BYTE_SIZE_NAME       "rdcc_nbytes"   /* Size of raw data chunk cache(bytes) */
 #define H5F_ACS_PREEMPT_READ_CHUNKS_NAME        "rdcc_w0"       /* Preemption read chunks first */
+#define H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_NAME "rdcc_shared_nbytes" /* Size of file-wide shared raw data chunk cache(bytes) */
 #define H5F_ACS_ALIGN_THRHD_NAME                "threshold"     /* Threshold for alignment */
 #define H5F_ACS_ALIGN_NAME                      "align"         /* Alignment */
 #define H5F_ACS_META_BLOCK_SIZE_NAME            "meta_block_size" /* Minimum metadata allocation block size (when aggregating metadata allocations) */
@@ -692,6 +695,17 @@ typedef struct H5F_block_t {
     hsize_t length;             /* Length of the block in the file */
 } H5F_block_t;
 
+/* File-wide raw data chunk cache, shared by all chunked datasets in a file */
+/* (The entries are owned & managed by the H5D package) */
+struct H5D_rdcc_ent_t;
+typedef struct H5F_rdcc_shared_t {
+    size_t      nbytes_max;     /* Maximum cached raw data for all datasets (bytes), 0 if disabled */
+    size_t      nbytes_used;    /* Current cached raw data for all datasets (bytes) */
+    size_t      nused;          /* Number of chunks cached for all datasets */
+    struct H5D_rdcc_ent_t *head; /* Head of file-wide LRU list (least recently used) */
+    struct H5D_rdcc_ent_t *tail; /* Tail of file-wide LRU list (most recently used) */
+} H5F_rdcc_shared_t;
+
 /* Enum for free space manager state */
 typedef enum H5F_fs_state_t {
     H5F_FS_STATE_CLOSED = 0,                /* Free space manager is closed */
@@ -778,6 +792,7 @@ H5_DLL hbool_t H5F_get_evict_on_close(const H5F_t *f);
 H5_DLL size_t H5F_rdcc_nbytes(const H5F_t *f);
 H5_DLL size_t H5F_rdcc_nslots(const H5F_t *f);
 H5_DLL double H5F_rdcc_w0(const H5F_t *f);
+H5_DLL H5F_rdcc_shared_t *H5F_rdcc_shared(const H5F_t *f);
 H5_DLL size_t H5F_sieve_buf_size(const H5F_t *f);
 H5_DLL unsigned H5F_gc_ref(const H5F_t *f);
 H5_DLL unsigned H5F_use_latest_flags(const H5F_t *f, unsigned fl);
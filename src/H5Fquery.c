@@ -585,6 +585,28 @@ H5F_rdcc_w0(const H5F_t *f)
     FUNC_LEAVE_NOAPI(f->shared->rdcc_w0)
 } /* end H5F_rdcc_w0() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: H5F_rdcc_shared
+ *
+ * Purpose:  Retrieve the file-wide shared raw data chunk cache info.
+ *
+ * Return:   Success:    Pointer to the file's shared chunk cache info
+ *           Failure:    (should not happen)
+ *-------------------------------------------------------------------------
+ */
+H5F_rdcc_shared_t *
+H5F_rdcc_shared(const H5F_t *f)
+{
+    /* Use FUNC_ENTER_NOAPI_NOINIT_NOERR here to avoid performance issues */
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    HDassert(f);
+    HDassert(f->shared);
+
+    FUNC_LEAVE_NOAPI(&f->shared->rdcc_shared)
+} /* end H5F_rdcc_shared() */
+
 
 /*-------------------------------------------------------------------------
  * Function: H5F_get_base_addr
@@ -61,6 +61,26 @@
 #define H5D_ACS_PREEMPT_READ_CHUNKS_DEF         H5D_CHUNK_CACHE_W0_DEFAULT
 #define H5D_ACS_PREEMPT_READ_CHUNKS_ENC         H5P__encode_double
 #define H5D_ACS_PREEMPT_READ_CHUNKS_DEC         H5P__decode_double
+/* Definitions for raw data chunk cache replacement policy */
+#define H5D_ACS_DATA_CACHE_POLICY_SIZE          sizeof(H5D_chunk_cache_policy_t)
+#define H5D_ACS_DATA_CACHE_POLICY_DEF           H5D_CHUNK_CACHE_POLICY_LRU
+#define H5D_ACS_DATA_CACHE_POLICY_ENC           H5P__dacc_cache_policy_enc
+#define H5D_ACS_DATA_CACHE_POLICY_DEC           H5P__dacc_cache_policy_dec
+/* Definitions for raw data chunk write back threads */
+#define H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_SIZE  sizeof(unsigned)
+#define H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_DEF   1
+#define H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_ENC   H5P__encode_unsigned
+#define H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_DEC   H5P__decode_unsigned
+/* Definitions for raw data chunk read-ahead */
+#define H5D_ACS_DATA_CACHE_PREFETCH_SIZE        sizeof(size_t)
+#define H5D_ACS_DATA_CACHE_PREFETCH_DEF         0
+#define H5D_ACS_DATA_CACHE_PREFETCH_ENC         H5P__encode_size_t
+#define H5D_ACS_DATA_CACHE_PREFETCH_DEC         H5P__decode_size_t
+/* Definitions for raw data chunk address cache */
+#define H5D_ACS_DATA_CACHE_CINFO_NBYTES_SIZE    sizeof(size_t)
+#define H5D_ACS_DATA_CACHE_CINFO_NBYTES_DEF     (64 * 1024)
+#define H5D_ACS_DATA_CACHE_CINFO_NBYTES_ENC     H5P__encode_size_t
+#define H5D_ACS_DATA_CACHE_CINFO_NBYTES_DEC     H5P__decode_size_t
 /* Definitions for VDS view option */
 #define H5D_ACS_VDS_VIEW_SIZE                   sizeof(H5D_vds_view_t)
 #define H5D_ACS_VDS_VIEW_DEF                    H5D_VDS_LAST_AVAILABLE
@@ -121,6 +141,8 @@ static herr_t H5P__encode_chunk_cache_nbytes(const void *value, void **_pp,
 static herr_t H5P__decode_chunk_cache_nbytes(const void **_pp, void *_value);
 
 /* Property list callbacks */
+static herr_t H5P__dacc_cache_policy_enc(const void *value, void **pp, size_t *size);
+static herr_t H5P__dacc_cache_policy_dec(const void **pp, void *value);
 static herr_t H5P__dacc_vds_view_enc(const void *value, void **pp, size_t *size);
 static herr_t H5P__dacc_vds_view_dec(const void **pp, void *value);
 static herr_t H5P__dapl_vds_file_pref_set(hid_t prop_id, const char* name, size_t size, void* value);
@@ -197,6 +219,10 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
     size_t rdcc_nslots = H5D_ACS_DATA_CACHE_NUM_SLOTS_DEF;      /* Default raw data chunk cache # of slots */
     size_t rdcc_nbytes = H5D_ACS_DATA_CACHE_BYTE_SIZE_DEF;      /* Default raw data chunk cache # of bytes */
     double rdcc_w0 = H5D_ACS_PREEMPT_READ_CHUNKS_DEF;           /* Default raw data chunk cache dirty ratio */
+    H5D_chunk_cache_policy_t rdcc_policy = H5D_ACS_DATA_CACHE_POLICY_DEF; /* Default raw data chunk cache replacement policy */
+    unsigned rdcc_flush_nthreads = H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_DEF; /* Default number of threads filtering chunks written back */
+    size_t rdcc_prefetch = H5D_ACS_DATA_CACHE_PREFETCH_DEF;     /* Default number of chunks to read ahead */
+    size_t rdcc_cinfo_nbytes = H5D_ACS_DATA_CACHE_CINFO_NBYTES_DEF; /* Default size of chunk address cache (bytes) */
     H5D_vds_view_t virtual_view = H5D_ACS_VDS_VIEW_DEF;         /* Default VDS view option */
     hsize_t printf_gap = H5D_ACS_VDS_PRINTF_GAP_DEF;            /* Default VDS printf gap */
     herr_t ret_value = SUCCEED;         /* Return value */
@@ -218,6 +244,26 @@ H5P__dacc_reg_prop(H5P_genclass_t *pclass)
              NULL, NULL, NULL, H5D_ACS_PREEMPT_READ_CHUNKS_ENC, H5D_ACS_PREEMPT_READ_CHUNKS_DEC, NULL, NULL, NULL, NULL) < 0)
          HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the raw data chunk cache replacement policy */
+    if(H5P_register_real(pclass, H5D_ACS_DATA_CACHE_POLICY_NAME, H5D_ACS_DATA_CACHE_POLICY_SIZE, &rdcc_policy,
+             NULL, NULL, NULL, H5D_ACS_DATA_CACHE_POLICY_ENC, H5D_ACS_DATA_CACHE_POLICY_DEC, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the number of threads filtering raw data chunks written back */
+    if(H5P_register_real(pclass, H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_NAME, H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_SIZE, &rdcc_flush_nthreads,
+             NULL, NULL, NULL, H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_ENC, H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_DEC, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the number of raw data chunks to read ahead */
+    if(H5P_register_real(pclass, H5D_ACS_DATA_CACHE_PREFETCH_NAME, H5D_ACS_DATA_CACHE_PREFETCH_SIZE, &rdcc_prefetch,
+             NULL, NULL, NULL, H5D_ACS_DATA_CACHE_PREFETCH_ENC, H5D_ACS_DATA_CACHE_PREFETCH_DEC, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
+    /* Register the size of the raw data chunk address cache (bytes) */
+    if(H5P_register_real(pclass, H5D_ACS_DATA_CACHE_CINFO_NBYTES_NAME, H5D_ACS_DATA_CACHE_CINFO_NBYTES_SIZE, &rdcc_cinfo_nbytes,
+             NULL, NULL, NULL, H5D_ACS_DATA_CACHE_CINFO_NBYTES_ENC, H5D_ACS_DATA_CACHE_CINFO_NBYTES_DEC, NULL, NULL, NULL, NULL) < 0)
+         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the VDS view option */
     if(H5P_register_real(pclass, H5D_ACS_VDS_VIEW_NAME, H5D_ACS_VDS_VIEW_SIZE, &virtual_view,
             NULL, NULL, NULL, H5D_ACS_VDS_VIEW_ENC, H5D_ACS_VDS_VIEW_DEC,
@@ -770,6 +816,10 @@ H5P__dapl_efile_pref_close(const char H5_ATTR_UNUSED *name, size_t H5_ATTR_UNUSE
  *        of one means fully read chunks are always preempted before
  *        other chunks.
  *
+ *        The chunk cache's hash table grows with the number of cached
+ *        chunks, so RDCC_NSLOTS no longer needs to be tuned; setting it
+ *        to zero still disables the chunk cache.
+ *
  * Return:    Non-negative on success/Negative on failure
  *-------------------------------------------------------------------------
  */
@@ -1068,6 +1118,380 @@ H5P__decode_chunk_cache_nbytes(const void **_pp, void *_value)
     FUNC_LEAVE_NOAPI(SUCCEED)
 } /* end H5P__decode_chunk_cache_nbytes() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_cache_policy
+ *
+ * Purpose:     Set the replacement policy of the raw data chunk cache for
+ *              a dataset opened with this dataset access property list.
+ *
+ *              H5D_CHUNK_CACHE_POLICY_LRU (the default) preempts chunks in
+ *              least recently used order, preferring fully read or written
+ *              chunks according to the w0 value set with
+ *              H5Pset_chunk_cache().
+ *
+ *              H5D_CHUNK_CACHE_POLICY_2Q keeps chunks that have only been
+ *              accessed once on a probationary FIFO queue and promotes a
+ *              chunk to the protected LRU queue only when it is accessed
+ *              again after leaving the probationary queue.  A sequential
+ *              scan of a dataset can therefore not displace its
+ *              frequently used chunks.  The w0 value is ignored.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_cache_policy(hid_t dapl_id, H5D_chunk_cache_policy_t policy)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iDr", dapl_id, policy);
+
+    /* Check argument */
+    if((policy != H5D_CHUNK_CACHE_POLICY_LRU) && (policy != H5D_CHUNK_CACHE_POLICY_2Q))
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "not a valid chunk cache replacement policy")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_ACS_DATA_CACHE_POLICY_NAME, &policy) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_cache_policy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_cache_policy
+ *
+ * Purpose:     Retrieves the raw data chunk cache replacement policy set
+ *              by H5Pset_chunk_cache_policy().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_cache_policy(hid_t dapl_id, H5D_chunk_cache_policy_t *policy)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*Dr", dapl_id, policy);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value from property list */
+    if(policy)
+        if(H5P_get(plist, H5D_ACS_DATA_CACHE_POLICY_NAME, policy) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_cache_policy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_flush_nthreads
+ *
+ * Purpose:     Set the number of threads that run the I/O filter pipeline
+ *              on the dirty chunks of a dataset opened with this dataset
+ *              access property list, when its chunk cache writes them back.
+ *
+ *              With more than one thread, the chunks are written back in
+ *              batches whenever the chunk cache preempts dirty chunks, and
+ *              when the dataset or its file is flushed or closed, and
+ *              their filters run concurrently.  File space allocation and
+ *              chunk index updates are not concurrent.  Like the other
+ *              chunk cache settings, the number is taken from the dataset
+ *              access property list used when the dataset is created or
+ *              first opened, and applies until all of its handles are
+ *              closed.
+ *
+ *              The filters are run on worker threads under the same
+ *              conditions as with H5Pset_filter_nthreads: only in
+ *              thread-safe builds, and only for the built-in filters.
+ *              The default is to use 1 thread.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_flush_nthreads(hid_t dapl_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", dapl_id, nthreads);
+
+    /* Check arguments */
+    if(nthreads < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be positive")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_flush_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_flush_nthreads
+ *
+ * Purpose:     Retrieves the number of threads set by
+ *              H5Pset_chunk_flush_nthreads().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_flush_nthreads(hid_t dapl_id, unsigned *nthreads)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*Iu", dapl_id, nthreads);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value from property list */
+    if(nthreads)
+        if(H5P_get(plist, H5D_ACS_DATA_CACHE_FLUSH_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_flush_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_prefetch
+ *
+ * Purpose:     Set the number of chunks the raw data chunk cache reads
+ *              ahead for a dataset opened with this dataset access
+ *              property list.
+ *
+ *              When the chunks touched by successive reads follow a
+ *              constant stride in chunk coordinates (along any number of
+ *              dimensions), each H5Dread that continues the pattern reads
+ *              the next NCHUNKS chunks along the stride into the chunk
+ *              cache before it returns, so that the following reads find
+ *              them there.  The chunks are unfiltered as they are read, by
+ *              as many threads as set with H5Pset_filter_nthreads().
+ *              Fewer chunks are read ahead if they wouldn't fit in the
+ *              chunk cache.  Zero (the default) disables reading ahead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_prefetch(hid_t dapl_id, size_t nchunks)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", dapl_id, nchunks);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_ACS_DATA_CACHE_PREFETCH_NAME, &nchunks) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_prefetch
+ *
+ * Purpose:     Retrieves the number of chunks to read ahead set by
+ *              H5Pset_chunk_prefetch().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_prefetch(hid_t dapl_id, size_t *nchunks)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*z", dapl_id, nchunks);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value from property list */
+    if(nchunks)
+        if(H5P_get(plist, H5D_ACS_DATA_CACHE_PREFETCH_NAME, nchunks) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_chunk_addr_cache
+ *
+ * Purpose:     Set the amount of memory used to remember where the chunks
+ *              of a dataset opened with this dataset access property list
+ *              are stored in the file.
+ *
+ *              Looking up a chunk's address in the chunk index costs a
+ *              search of the index for every chunk that isn't in the
+ *              chunk cache.  Addresses that have been looked up are kept
+ *              in a table of up to NBYTES bytes, so that reading a chunk
+ *              again after it has been evicted from the chunk cache
+ *              doesn't search the index again.  The table only grows as
+ *              chunks are looked up.  Zero disables it; the default is
+ *              64 KiB.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_chunk_addr_cache(hid_t dapl_id, size_t nbytes)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", dapl_id, nbytes);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_ACS_DATA_CACHE_CINFO_NBYTES_NAME, &nbytes) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_chunk_addr_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_chunk_addr_cache
+ *
+ * Purpose:     Retrieves the size of the chunk address cache set by
+ *              H5Pset_chunk_addr_cache().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_chunk_addr_cache(hid_t dapl_id, size_t *nbytes)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*z", dapl_id, nbytes);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(dapl_id, H5P_DATASET_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get value from property list */
+    if(nbytes)
+        if(H5P_get(plist, H5D_ACS_DATA_CACHE_CINFO_NBYTES_NAME, nbytes) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_chunk_addr_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dacc_cache_policy_enc
+ *
+ * Purpose:     Callback routine which is called whenever the chunk cache
+ *              policy property in the dataset access property list is
+ *              encoded.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dacc_cache_policy_enc(const void *value, void **_pp, size_t *size)
+{
+    const H5D_chunk_cache_policy_t *policy = (const H5D_chunk_cache_policy_t *)value; /* Create local alias for values */
+    uint8_t **pp = (uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity check */
+    HDassert(policy);
+    HDassert(size);
+
+    if(NULL != *pp)
+        /* Encode policy property */
+        *(*pp)++ = (uint8_t)*policy;
+
+    /* Size of policy property */
+    (*size)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__dacc_cache_policy_enc() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5P__dacc_cache_policy_dec
+ *
+ * Purpose:     Callback routine which is called whenever the chunk cache
+ *              policy property in the dataset access property list is
+ *              decoded.
+ *
+ * Return:      Success:        Non-negative
+ *              Failure:        Negative
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5P__dacc_cache_policy_dec(const void **_pp, void *_value)
+{
+    H5D_chunk_cache_policy_t *policy = (H5D_chunk_cache_policy_t *)_value;
+    const uint8_t **pp = (const uint8_t **)_pp;
+
+    FUNC_ENTER_STATIC_NOERR
+
+    /* Sanity checks */
+    HDassert(pp);
+    HDassert(*pp);
+    HDassert(policy);
+
+    /* Decode policy property */
+    *policy = (H5D_chunk_cache_policy_t)*(*pp)++;
+
+    FUNC_LEAVE_NOAPI(SUCCEED)
+} /* end H5P__dacc_cache_policy_dec() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_virtual_view
@@ -91,6 +91,11 @@
 #define H5D_XFER_HYPER_VECTOR_SIZE_DEF  H5D_IO_VECTOR_SIZE
 #define H5D_XFER_HYPER_VECTOR_SIZE_ENC  H5P__encode_size_t
 #define H5D_XFER_HYPER_VECTOR_SIZE_DEC  H5P__decode_size_t
+/* Definitions for chunk filter thread count property */
+#define H5D_XFER_FILTER_NTHREADS_SIZE   sizeof(unsigned)
+#define H5D_XFER_FILTER_NTHREADS_DEF    1
+#define H5D_XFER_FILTER_NTHREADS_ENC    H5P__encode_unsigned
+#define H5D_XFER_FILTER_NTHREADS_DEC    H5P__decode_unsigned
 
 /* Parallel I/O properties */
 /* Note: Some of these are registered with the DXPL class even when parallel
@@ -278,6 +283,7 @@ static const void *H5D_def_vlen_alloc_info_g = H5D_XFER_VLEN_ALLOC_INFO_DEF;   /
 static const H5MM_free_t H5D_def_vlen_free_g = H5D_XFER_VLEN_FREE_DEF;         /* Default value for vlen free function */
 static const void *H5D_def_vlen_free_info_g = H5D_XFER_VLEN_FREE_INFO_DEF;     /* Default value for vlen free information */
 static const size_t H5D_def_hyp_vec_size_g = H5D_XFER_HYPER_VECTOR_SIZE_DEF;   /* Default value for vector size */
+static const unsigned H5D_def_filter_nthreads_g = H5D_XFER_FILTER_NTHREADS_DEF; /* Default value for chunk filter threads */
 static const haddr_t H5D_def_tag_g = H5AC_TAG_DEF;                              /* Default value for cache entry tag */
 static const H5FD_mpio_xfer_t H5D_def_io_xfer_mode_g = H5D_XFER_IO_XFER_MODE_DEF;      /* Default value for I/O transfer mode */
 static const H5FD_mpio_chunk_opt_t H5D_def_mpio_chunk_opt_mode_g = H5D_XFER_MPIO_CHUNK_OPT_HARD_DEF;
@@ -392,6 +398,12 @@ H5P__dxfr_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the chunk filter thread count property */
+    if(H5P_register_real(pclass, H5D_XFER_FILTER_NTHREADS_NAME, H5D_XFER_FILTER_NTHREADS_SIZE, &H5D_def_filter_nthreads_g,
+            NULL, NULL, NULL, H5D_XFER_FILTER_NTHREADS_ENC, H5D_XFER_FILTER_NTHREADS_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the I/O transfer mode properties */
     if(H5P_register_real(pclass, H5D_XFER_IO_XFER_MODE_NAME, H5D_XFER_IO_XFER_MODE_SIZE, &H5D_def_io_xfer_mode_g, 
             NULL, NULL, NULL, H5D_XFER_IO_XFER_MODE_ENC, H5D_XFER_IO_XFER_MODE_DEC,
@@ -1864,6 +1876,94 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_hyper_vector_size() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pset_filter_nthreads
+ *
+ * Purpose:	Given a dataset transfer property list, set the number of
+ *              threads that run the I/O filter pipeline on the chunks of a
+ *              filtered dataset.  When more than one thread is requested,
+ *              a read that touches several chunks reads them from the file
+ *              in advance and undoes their filters concurrently, before the
+ *              data is scattered into the application's buffer.  The call
+ *              still returns only when all the data has been read.
+ *              Dirty chunks are filtered when the chunk cache writes them
+ *              back, by the number of threads set for the dataset with
+ *              H5Pset_chunk_flush_nthreads.
+ *
+ *              Only the built-in filters (deflate, shuffle, fletcher32,
+ *              szip, nbit and scale-offset) are run on worker threads.
+ *              Application filters may call back into the library, which
+ *              is locked by the calling thread, so when a dataset's
+ *              pipeline contains any other filter, or a filter callback is
+ *              set with H5Pset_filter_callback, its chunks are filtered by
+ *              the calling thread.  Threads are only used when the library
+ *              is built thread-safe; otherwise the chunks are still
+ *              batched but filtered by the calling thread.
+ *
+ *		The default is to use 1 thread.
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_filter_nthreads(hid_t plist_id, unsigned nthreads)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iIu", plist_id, nthreads);
+
+    /* Check arguments */
+    if(nthreads < 1)
+        HGOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "number of threads must be positive")
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Update property list */
+    if(H5P_set(plist, H5D_XFER_FILTER_NTHREADS_NAME, &nthreads) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "unable to set value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_filter_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:	H5Pget_filter_nthreads
+ *
+ * Purpose:	Reads values previously set with H5Pset_filter_nthreads().
+ *
+ * Return:	Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_filter_nthreads(hid_t plist_id, unsigned *nthreads/*out*/)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED; /* Return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "ix", plist_id, nthreads);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id, H5P_DATASET_XFER)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Return values */
+    if(nthreads)
+        if(H5P_get(plist, H5D_XFER_FILTER_NTHREADS_NAME, nthreads) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "unable to get value")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_filter_nthreads() */
+
 
 /*-------------------------------------------------------------------------
  * Function:       H5P__dxfr_io_xfer_mode_enc
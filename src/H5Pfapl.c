@@ -74,6 +74,11 @@
 #define H5F_ACS_PREEMPT_READ_CHUNKS_DEF         0.75f
 #define H5F_ACS_PREEMPT_READ_CHUNKS_ENC         H5P__encode_double
 #define H5F_ACS_PREEMPT_READ_CHUNKS_DEC         H5P__decode_double
+/* Definition for size of file-wide shared raw data chunk cache(bytes) */
+#define H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_SIZE sizeof(size_t)
+#define H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_DEF  0
+#define H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_ENC  H5P__encode_size_t
+#define H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_DEC  H5P__decode_size_t
 /* Definition for threshold for alignment */
 #define H5F_ACS_ALIGN_THRHD_SIZE                sizeof(hsize_t)
 #define H5F_ACS_ALIGN_THRHD_DEF                 H5F_ALIGN_THRHD_DEF
@@ -341,6 +346,7 @@ static const H5AC_cache_config_t H5F_def_mdc_initCacheCfg_g = H5F_ACS_META_CACHE
 static const size_t H5F_def_rdcc_nslots_g = H5F_ACS_DATA_CACHE_NUM_SLOTS_DEF;      /* Default raw data chunk cache # of slots */
 static const size_t H5F_def_rdcc_nbytes_g = H5F_ACS_DATA_CACHE_BYTE_SIZE_DEF;      /* Default raw data chunk cache # of bytes */
 static const double H5F_def_rdcc_w0_g = H5F_ACS_PREEMPT_READ_CHUNKS_DEF;           /* Default raw data chunk cache dirty ratio */
+static const size_t H5F_def_rdcc_shared_nbytes_g = H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_DEF;  /* Default file-wide shared raw data chunk cache # of bytes */
 static const hsize_t H5F_def_threshold_g = H5F_ACS_ALIGN_THRHD_DEF;                /* Default allocation alignment threshold */
 static const hsize_t H5F_def_alignment_g = H5F_ACS_ALIGN_DEF;                      /* Default allocation alignment value */
 static const hsize_t H5F_def_meta_block_size_g = H5F_ACS_META_BLOCK_SIZE_DEF;      /* Default metadata allocation block size */
@@ -418,6 +424,12 @@ H5P__facc_reg_prop(H5P_genclass_t *pclass)
             NULL, NULL, NULL, NULL) < 0)
         HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
 
+    /* Register the size of the file-wide shared raw data chunk cache(bytes) */
+    if(H5P_register_real(pclass, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_NAME, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_SIZE, &H5F_def_rdcc_shared_nbytes_g,
+            NULL, NULL, NULL, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_ENC, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_DEC,
+            NULL, NULL, NULL, NULL) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into class")
+
     /* Register the threshold for alignment */
     if(H5P_register_real(pclass, H5F_ACS_ALIGN_THRHD_NAME, H5F_ACS_ALIGN_THRHD_SIZE, &H5F_def_threshold_g,
             NULL, NULL, NULL, H5F_ACS_ALIGN_THRHD_ENC, H5F_ACS_ALIGN_THRHD_DEC,
@@ -1500,6 +1512,10 @@ done:
  *        of one means fully read chunks are always preempted before
  *        other chunks.
  *
+ *        The chunk cache's hash table grows with the number of cached
+ *        chunks, so RDCC_NSLOTS no longer needs to be tuned; setting it
+ *        to zero still disables the chunk cache.
+ *
  * Return:    Non-negative on success/Negative on failure
  *
  * Programmer:    Robb Matzke
@@ -1590,6 +1606,82 @@ done:
     FUNC_LEAVE_API(ret_value)
 } /* end H5Pget_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pset_shared_chunk_cache
+ *
+ * Purpose:     Set the byte budget of a raw data chunk cache that is shared
+ *              by all chunked datasets opened in the file.  Chunks from
+ *              every dataset compete for the same NBYTES of memory, with
+ *              least recently used chunks of any dataset preempted first.
+ *
+ *              A value of zero (the default) disables the shared cache, in
+ *              which case each dataset gets a private chunk cache sized by
+ *              H5Pset_cache() / H5Pset_chunk_cache().
+ *
+ *              When the shared cache is enabled, datasets that do not set
+ *              their own byte size with H5Pset_chunk_cache() are limited
+ *              only by the shared budget.  A byte size set on a dataset
+ *              access property list acts as a cap on that dataset's share.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pset_shared_chunk_cache(hid_t plist_id, size_t nbytes)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "iz", plist_id, nbytes);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Set size */
+    if(H5P_set(plist, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_NAME, &nbytes) < 0)
+        HGOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set shared data cache byte size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pset_shared_chunk_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function:    H5Pget_shared_chunk_cache
+ *
+ * Purpose:     Retrieves the byte budget of the file-wide shared raw data
+ *              chunk cache.  Zero means the shared cache is disabled.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5Pget_shared_chunk_cache(hid_t plist_id, size_t *nbytes)
+{
+    H5P_genplist_t *plist;      /* Property list pointer */
+    herr_t ret_value = SUCCEED;   /* return value */
+
+    FUNC_ENTER_API(FAIL)
+    H5TRACE2("e", "i*z", plist_id, nbytes);
+
+    /* Get the plist structure */
+    if(NULL == (plist = H5P_object_verify(plist_id,H5P_FILE_ACCESS)))
+        HGOTO_ERROR(H5E_ATOM, H5E_BADATOM, FAIL, "can't find object for ID")
+
+    /* Get size */
+    if(nbytes)
+        if(H5P_get(plist, H5F_ACS_DATA_CACHE_SHARED_BYTE_SIZE_NAME, nbytes) < 0)
+            HGOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get shared data cache byte size")
+
+done:
+    FUNC_LEAVE_API(ret_value)
+} /* end H5Pget_shared_chunk_cache() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_mdc_image_config
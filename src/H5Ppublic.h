@@ -323,6 +323,8 @@ H5_DLL herr_t H5Pget_cache(hid_t plist_id,
        int *mdc_nelmts, /* out */
        size_t *rdcc_nslots/*out*/,
        size_t *rdcc_nbytes/*out*/, double *rdcc_w0);
+H5_DLL herr_t H5Pset_shared_chunk_cache(hid_t plist_id, size_t nbytes);
+H5_DLL herr_t H5Pget_shared_chunk_cache(hid_t plist_id, size_t *nbytes/*out*/);
 H5_DLL herr_t H5Pset_mdc_config(hid_t    plist_id,
        H5AC_cache_config_t * config_ptr);
 H5_DLL herr_t H5Pget_mdc_config(hid_t     plist_id,
@@ -416,6 +418,16 @@ H5_DLL herr_t H5Pget_chunk_cache(hid_t dapl_id,
        size_t *rdcc_nslots/*out*/,
        size_t *rdcc_nbytes/*out*/,
        double *rdcc_w0/*out*/);
+H5_DLL herr_t H5Pset_chunk_cache_policy(hid_t dapl_id,
+       H5D_chunk_cache_policy_t policy);
+H5_DLL herr_t H5Pget_chunk_cache_policy(hid_t dapl_id,
+       H5D_chunk_cache_policy_t *policy/*out*/);
+H5_DLL herr_t H5Pset_chunk_flush_nthreads(hid_t dapl_id, unsigned nthreads);
+H5_DLL herr_t H5Pget_chunk_flush_nthreads(hid_t dapl_id, unsigned *nthreads/*out*/);
+H5_DLL herr_t H5Pset_chunk_prefetch(hid_t dapl_id, size_t nchunks);
+H5_DLL herr_t H5Pget_chunk_prefetch(hid_t dapl_id, size_t *nchunks/*out*/);
+H5_DLL herr_t H5Pset_chunk_addr_cache(hid_t dapl_id, size_t nbytes);
+H5_DLL herr_t H5Pget_chunk_addr_cache(hid_t dapl_id, size_t *nbytes/*out*/);
 H5_DLL herr_t H5Pset_virtual_view(hid_t plist_id, H5D_vds_view_t view);
 H5_DLL herr_t H5Pget_virtual_view(hid_t plist_id, H5D_vds_view_t *view);
 H5_DLL herr_t H5Pset_virtual_printf_gap(hid_t plist_id, hsize_t gap_size);
@@ -458,6 +470,8 @@ H5_DLL herr_t H5Pget_vlen_mem_manager(hid_t plist_id,
                                        void **free_info);
 H5_DLL herr_t H5Pset_hyper_vector_size(hid_t fapl_id, size_t size);
 H5_DLL herr_t H5Pget_hyper_vector_size(hid_t fapl_id, size_t *size/*out*/);
+H5_DLL herr_t H5Pset_filter_nthreads(hid_t plist_id, unsigned nthreads);
+H5_DLL herr_t H5Pget_filter_nthreads(hid_t plist_id, unsigned *nthreads/*out*/);
 H5_DLL herr_t H5Pset_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t op, void* operate_data);
 H5_DLL herr_t H5Pget_type_conv_cb(hid_t dxpl_id, H5T_conv_except_func_t *op, void** operate_data);
 #ifdef H5_HAVE_PARALLEL
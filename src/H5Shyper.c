@@ -10344,6 +10344,66 @@ done:
     FUNC_LEAVE_NOAPI(ret_value)
 } /* end H5S_hyper_get_first_inc_block */
 
+
+/*--------------------------------------------------------------------------
+ NAME
+    H5S_hyper_get_regular
+ PURPOSE
+    Get the "optimized" parameters of a regular hyperslab selection
+ USAGE
+    htri_t H5S_hyper_get_regular(space,start,stride,count,block)
+        const H5S_t *space;     IN: Dataspace to query
+        hsize_t start[];        OUT: Offset of start of hyperslab
+        hsize_t stride[];       OUT: Hyperslab stride
+        hsize_t count[];        OUT: Number of blocks included in hyperslab
+        hsize_t block[];        OUT: Size of block in hyperslab
+ RETURNS
+    TRUE if the selection is a regular hyperslab, FALSE if it isn't, FAIL
+    on error.
+ DESCRIPTION
+    Retrieves the start, stride, count and block of a regular hyperslab
+    selection, after contiguous blocks are merged: the stride of a
+    dimension with one block is 1, and blocks are never adjacent.  Unlike
+    H5Sget_regular_hyperslab(), a selection that isn't regular (or is
+    unlimited) isn't an error.
+ GLOBAL VARIABLES
+ COMMENTS, BUGS, ASSUMPTIONS
+    The selection offset isn't included in the start.
+ EXAMPLES
+ REVISION LOG
+--------------------------------------------------------------------------*/
+htri_t
+H5S_hyper_get_regular(const H5S_t *space, hsize_t start[], hsize_t stride[],
+    hsize_t count[], hsize_t block[])
+{
+    const H5S_hyper_dim_t *diminfo;     /* Alias for selection's diminfo */
+    unsigned u;                         /* Local index variable */
+    htri_t ret_value = TRUE;            /* Return value */
+
+    FUNC_ENTER_NOAPI_NOINIT_NOERR
+
+    /* Check args */
+    HDassert(space);
+
+    /* Only hyperslab selections with "optimized" information can be used */
+    if(H5S_GET_SELECT_TYPE(space) != H5S_SEL_HYPERSLABS
+            || !space->select.sel_info.hslab->diminfo_valid
+            || space->select.sel_info.hslab->unlim_dim >= 0)
+        HGOTO_DONE(FALSE)
+
+    /* Retrieve hyperslab parameters */
+    diminfo = space->select.sel_info.hslab->opt_diminfo;
+    for(u = 0; u < space->extent.rank; u++) {
+        start[u] = diminfo[u].start;
+        stride[u] = diminfo[u].stride;
+        count[u] = diminfo[u].count;
+        block[u] = diminfo[u].block;
+    } /* end for */
+
+done:
+    FUNC_LEAVE_NOAPI(ret_value)
+} /* end H5S_hyper_get_regular() */
+
 
 /*--------------------------------------------------------------------------
  NAME
@@ -304,6 +304,8 @@ H5_DLL H5S_t *H5S_hyper_get_unlim_block(const H5S_t *space,
     hsize_t block_index);
 H5_DLL hsize_t H5S_hyper_get_first_inc_block(const H5S_t *space,
     hsize_t clip_size, hbool_t *partial);
+H5_DLL htri_t H5S_hyper_get_regular(const H5S_t *space, hsize_t start[],
+    hsize_t stride[], hsize_t count[], hsize_t block[]);
 
 /* Operations on selection iterators */
 H5_DLL herr_t H5S_select_iter_init(H5S_sel_iter_t *iter, const H5S_t *space, size_t elmt_size);
@@ -483,6 +483,9 @@ H5TS_win32_thread_exit(void)
  *
  * DESCRIPTION
  *    Spawn off a new thread calling function 'func' with input 'udata'.
+ *    A thread that cannot be created is not reported, so this is only
+ *    used by the test code; the library creates its threads with
+ *    H5TS_thread_create().
  *
  * PROGRAMMER: Mike McGreevy
  *             August 31, 2010
@@ -498,8 +501,8 @@ H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr, void *udata)
 
     /* When calling C runtime functions, you should use _beginthread or
      * _beginthreadex instead of CreateThread.  Threads created with
-     * CreateThread risk being killed in low-memory situations. Since we
-     * only create threads in our test code, this is unlikely to be an issue
+     * CreateThread risk being killed in low-memory situations. Since
+     * this is only used by the test code, this is unlikely to be an issue
      * and we'll use the easier-to-deal-with CreateThread for now.
      *
      * NOTE: _beginthread() auto-recycles its handle when execution completes
@@ -518,4 +521,42 @@ H5TS_create_thread(void *(*func)(void *), H5TS_attr_t *attr, void *udata)
 
 } /* H5TS_create_thread */
 
+
+/*--------------------------------------------------------------------------
+ * NAME
+ *    H5TS_thread_create
+ *
+ * RETURNS
+ *    Non-negative on success / Negative on failure
+ *
+ * DESCRIPTION
+ *    Spawn off a new thread calling function 'func' with input 'udata',
+ *    and return its identifier in 'thread'.  Unlike H5TS_create_thread(),
+ *    a thread that cannot be created is reported, so that the library
+ *    never waits for it with H5TS_wait_for_thread().
+ *
+ *--------------------------------------------------------------------------
+ */
+herr_t
+H5TS_thread_create(H5TS_thread_t *thread, void *(*func)(void *), void *udata)
+{
+#ifdef  H5_HAVE_WIN_THREADS
+
+    /* The library's threads call C runtime functions, so they are started
+     * with _beginthreadex() rather than CreateThread(), and unlike
+     * _beginthread() it leaves the handle open for H5TS_wait_for_thread().
+     */
+    if(0 == (*thread = (H5TS_thread_t)_beginthreadex(NULL, 0, (unsigned (__stdcall *)(void *))func, udata, 0, NULL)))
+        return FAIL;
+
+#else /* H5_HAVE_WIN_THREADS */
+
+    if(0 != pthread_create(thread, NULL, func, udata))
+        return FAIL;
+
+#endif /* H5_HAVE_WIN_THREADS */
+
+    return SUCCEED;
+} /* H5TS_thread_create */
+
 #endif  /* H5_HAVE_THREADSAFE */
@@ -658,6 +658,36 @@ H5_trace(const double *returning, const char *func, const char *type, ...)
                         } /* end else */
                         break;
 
+                    case 'r':
+                        if(ptr) {
+                            if(vp)
+                                fprintf(out, "0x%lx", (unsigned long)vp);
+                            else
+                                fprintf(out, "NULL");
+                        } /* end if */
+                        else {
+                            H5D_chunk_cache_policy_t policy = (H5D_chunk_cache_policy_t)va_arg(ap, int);
+
+                            switch(policy) {
+                                case H5D_CHUNK_CACHE_POLICY_ERROR:
+                                    fprintf(out, "H5D_CHUNK_CACHE_POLICY_ERROR");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_LRU:
+                                    fprintf(out, "H5D_CHUNK_CACHE_POLICY_LRU");
+                                    break;
+
+                                case H5D_CHUNK_CACHE_POLICY_2Q:
+                                    fprintf(out, "H5D_CHUNK_CACHE_POLICY_2Q");
+                                    break;
+
+                                default:
+                                    fprintf(out, "%ld", (long)policy);
+                                    break;
+                            } /* end switch */
+                        } /* end else */
+                        break;
+
                     case 's':
                         if(ptr) {
                             if(vp)
@@ -1788,6 +1788,7 @@ error:
     return 1;
 } /* end test_random_write() */
 
+
 /*-------------------------------------------------------------------------
  * Function:    test_swmr_write_big
  * 
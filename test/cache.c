@@ -199,6 +199,7 @@ static void cedds__expunge_dirty_entry_in_flush_test(H5F_t * file_ptr);
 static void cedds__H5C_make_space_in_cache(H5F_t * file_ptr);
 static void cedds__H5C__autoadjust__ageout__evict_aged_out_entries(H5F_t * file_ptr);
 static void cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr);
+static unsigned check_index_resize(unsigned paged);
 static unsigned check_stats(unsigned paged);
 #if H5C_COLLECT_CACHE_STATS
 static void check_stats__smoke_check_1(H5F_t * file_ptr);
@@ -35701,14 +35702,14 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
         HDassert(entry_addr == entry_ptr->addr);
 
-        expected_hash_bucket = H5C__HASH_FCN(entry_addr);
+        expected_hash_bucket = H5C__HASH_FCN(cache_ptr, entry_addr);
 
         for (i = 8; i <= 24; i += 8) {
         
             entry_ptr = &(base_addr[i]);
             entry_addr = entry_ptr->header.addr;
 
-            if(expected_hash_bucket != H5C__HASH_FCN(entry_addr)) {
+            if(expected_hash_bucket != H5C__HASH_FCN(cache_ptr, entry_addr)) {
 
                 pass = FALSE;
                 failure_mssg = "Test entries don't map to same bucket -- hash table size or hash fcn change?";
@@ -35747,7 +35748,7 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
         entry_ptr = &(base_addr[31]);
         entry_addr = entry_ptr->header.addr;
 
-        if(expected_hash_bucket == H5C__HASH_FCN(entry_addr)) {
+        if(expected_hash_bucket == H5C__HASH_FCN(cache_ptr, entry_addr)) {
 
             pass = FALSE;
             failure_mssg = "Dirty entry maps to same hash bucket as clean entries?!?!";
@@ -35908,6 +35909,203 @@ cedds__H5C_flush_invalidate_cache__bucket_scan(H5F_t * file_ptr)
 
 } /* cedds__H5C_flush_invalidate_cache__bucket_scan() */
 
+
+/*-------------------------------------------------------------------------
+ * Function:	check_index_resize()
+ *
+ * Purpose:	Verify that the hash table index grows as entries are
+ *		loaded, that every entry can still be found in the right
+ *		bucket after the buckets have been split, and that the
+ *		index shrinks back to its initial size as the entries are
+ *		expunged.
+ *
+ *		Enough entries are loaded to split several thousand of
+ *		the initial buckets.
+ *
+ * Return:	void
+ *
+ *-------------------------------------------------------------------------
+ */
+
+static unsigned
+check_index_resize(unsigned paged)
+{
+    static char    msg[128];
+    H5F_t *        file_ptr = NULL;
+    H5C_t *        cache_ptr = NULL;
+    H5C_cache_entry_t * scan_ptr;
+    test_entry_t * base_addr;
+    uint32_t       num_entries = 0;
+    uint32_t       num_scanned = 0;
+    int32_t        i, j;
+
+    if(paged)
+        TESTING("hash table index resizing (paged aggregation)")
+    else
+        TESTING("hash table index resizing")
+
+    pass = TRUE;
+
+    if(pass) {
+
+        reset_entries();
+
+        file_ptr = setup_cache((size_t)(64 * 1024 * 1024), (size_t)(32 * 1024 * 1024), paged);
+
+        if(file_ptr == NULL) {
+
+            pass = FALSE;
+            failure_mssg = "file_ptr NULL from setup_cache.";
+
+        } else {
+
+            cache_ptr = file_ptr->shared->cache;
+
+            if(cache_ptr->index_nbuckets != H5C__HASH_TABLE_LEN) {
+
+                pass = FALSE;
+                failure_mssg = "unexpected initial number of hash buckets.";
+            }
+        }
+    }
+
+    /* Load all the entries of the smaller types -- more than there are
+     * initial hash buckets -- without dirtying them.
+     */
+    for(i = 0; pass && (i <= LARGE_ENTRY_TYPE); i++)
+        for(j = 0; pass && (j <= max_indices[i]); j++) {
+
+            protect_entry(file_ptr, i, j);
+            unprotect_entry(file_ptr, i, j, H5C__NO_FLAGS_SET);
+            num_entries++;
+        }
+
+    if(pass) {
+
+        if((cache_ptr->index_len != num_entries) ||
+                (num_entries <= H5C__HASH_TABLE_LEN)) {
+
+            pass = FALSE;
+            HDsnprintf(msg, (size_t)128,
+                       "unexpected index_len %u (expected %u > %u).",
+                       (unsigned)cache_ptr->index_len, (unsigned)num_entries,
+                       (unsigned)H5C__HASH_TABLE_LEN);
+            failure_mssg = msg;
+
+        } else if((cache_ptr->index_nbuckets != cache_ptr->index_len) ||
+                (cache_ptr->index_nbuckets != (cache_ptr->index_mask + 1 +
+                                               cache_ptr->index_split)) ||
+                (cache_ptr->index_alloc < cache_ptr->index_nbuckets)) {
+
+            pass = FALSE;
+            HDsnprintf(msg, (size_t)128,
+                       "unexpected index geometry %u / %u / %u after growth.",
+                       (unsigned)cache_ptr->index_nbuckets,
+                       (unsigned)cache_ptr->index_split,
+                       (unsigned)cache_ptr->index_alloc);
+            failure_mssg = msg;
+        }
+    }
+
+    /* Every entry must be linked into the bucket it hashes to */
+    for(i = 0; pass && (i < (int32_t)cache_ptr->index_nbuckets); i++) {
+
+        scan_ptr = cache_ptr->index[i];
+
+        if((scan_ptr != NULL) && (scan_ptr->ht_prev != NULL)) {
+
+            pass = FALSE;
+            failure_mssg = "head of hash bucket has a predecessor.";
+        }
+
+        while(pass && (scan_ptr != NULL)) {
+
+            if(H5C__HASH_FCN(cache_ptr, scan_ptr->addr) != i) {
+
+                pass = FALSE;
+                HDsnprintf(msg, (size_t)128,
+                           "entry at 0x%llx in wrong hash bucket %d.",
+                           (unsigned long long)scan_ptr->addr, (int)i);
+                failure_mssg = msg;
+
+            } else if((scan_ptr->ht_next != NULL) &&
+                        (scan_ptr->ht_next->ht_prev != scan_ptr)) {
+
+                pass = FALSE;
+                failure_mssg = "bad hash bucket chain.";
+            }
+
+            num_scanned++;
+            scan_ptr = scan_ptr->ht_next;
+        }
+    }
+
+    if(pass && (num_scanned != num_entries)) {
+
+        pass = FALSE;
+        failure_mssg = "entries missing from hash buckets.";
+    }
+
+    /* Every entry must still be found by a lookup */
+    for(i = 0; pass && (i <= LARGE_ENTRY_TYPE); i++) {
+
+        base_addr = entries[i];
+
+        for(j = 0; pass && (j <= max_indices[i]); j++) {
+
+            H5C_TEST__SEARCH_INDEX(cache_ptr, base_addr[j].addr, scan_ptr)
+
+            if(scan_ptr != &(base_addr[j].header)) {
+
+                pass = FALSE;
+                HDsnprintf(msg, (size_t)128,
+                           "entry (%d, %d) not found in index.", (int)i, (int)j);
+                failure_mssg = msg;
+            }
+        }
+    }
+
+    /* Expunge the entries, in the order they were loaded, and check that
+     * the index shrinks back to its initial size.
+     */
+    for(i = 0; pass && (i <= LARGE_ENTRY_TYPE); i++)
+        for(j = 0; pass && (j <= max_indices[i]); j++)
+            expunge_entry(file_ptr, i, j);
+
+    if(pass) {
+
+        if((cache_ptr->index_len != 0) ||
+                (cache_ptr->index_nbuckets != H5C__HASH_TABLE_LEN) ||
+                (cache_ptr->index_split != 0) ||
+                (cache_ptr->index_mask != (size_t)(H5C__HASH_TABLE_LEN - 1))) {
+
+            pass = FALSE;
+            HDsnprintf(msg, (size_t)128,
+                       "unexpected index geometry %u / %u / %u after shrinking.",
+                       (unsigned)cache_ptr->index_len,
+                       (unsigned)cache_ptr->index_nbuckets,
+                       (unsigned)cache_ptr->index_split);
+            failure_mssg = msg;
+        }
+    }
+
+    if(pass) {
+
+        takedown_cache(file_ptr, FALSE, FALSE);
+    }
+
+    if(pass) { PASSED(); } else { H5_FAILED(); }
+
+    if(!pass) {
+
+        HDfprintf(stdout, "%s(): failure_mssg = \"%s\".\n",
+                  FUNC, failure_mssg);
+    }
+
+    return (unsigned)!pass;
+
+} /* check_index_resize() */
+
 
 /*-------------------------------------------------------------------------
  * Function:	check_stats()
@@ -36517,6 +36715,7 @@ main(void)
         nerrs += check_metadata_cork(TRUE, paged);
         nerrs += check_metadata_cork(FALSE, paged);
         nerrs += check_entry_deletions_during_scans(paged);
+        nerrs += check_index_resize(paged);
         nerrs += check_stats(paged);
     } /* end for */
 
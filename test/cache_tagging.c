@@ -162,7 +162,7 @@ verify_no_unknown_tags(hid_t fid)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->index_nbuckets; i++) {
         H5C_cache_entry_t *entry_ptr;      /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -210,7 +210,7 @@ mark_all_entries_investigated(hid_t fid)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->index_nbuckets; i++) {
         H5C_cache_entry_t *entry_ptr;      /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -256,7 +256,7 @@ reset_all_entries_investigated(hid_t fid)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->index_nbuckets; i++) {
         H5C_cache_entry_t *entry_ptr;      /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -304,7 +304,7 @@ verify_tag(hid_t fid, int id, haddr_t tag)
         TEST_ERROR;
     cache_ptr = f->shared->cache;
 
-    for(i = 0; i < H5C__HASH_TABLE_LEN; i++) {
+    for(i = 0; i < (int)cache_ptr->index_nbuckets; i++) {
         H5C_cache_entry_t *entry_ptr; /* entry pointer */
 
         entry_ptr = cache_ptr->index[i];
@@ -2222,6 +2222,7 @@ check_dataset_write_tags(void)
     hid_t sid = -1;                         /* Dataspace Identifier */
     int verbose = FALSE;                    /* verbose file outout */
     hid_t dcpl = -1;                        /* dataset creation pl */
+    hid_t dapl = -1;                        /* dataset access pl */
     hsize_t cdims[2] = {1,1};               /* chunk dimensions */
     int fillval = 0;
     haddr_t root_tag = 0;
@@ -2270,7 +2271,14 @@ check_dataset_write_tags(void)
     if ( H5Dclose(did) < 0 ) TEST_ERROR;
     if ( H5Fclose(fid) < 0 ) TEST_ERROR;
     if ( (fid = H5Fopen(FILENAME, H5F_ACC_RDWR, H5P_DEFAULT)) < 0 ) TEST_ERROR;
-    if (( did = H5Dopen2(fid, DATASETNAME, H5P_DEFAULT)) < 0 ) TEST_ERROR;
+
+    /* Disable the chunk cache, so that the chunks are written to the file
+     * (and the B-tree built) during the write
+     */
+    if ( (dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0 ) TEST_ERROR;
+    if ( H5Pset_chunk_cache(dapl, H5D_CHUNK_CACHE_NSLOTS_DEFAULT, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0 ) TEST_ERROR;
+    if (( did = H5Dopen2(fid, DATASETNAME, dapl)) < 0 ) TEST_ERROR;
+    if ( H5Pclose(dapl) < 0 ) TEST_ERROR;
 
     /* Evict as much as we can from the cache so we can track full tag path */
     if ( evict_entries(fid) < 0 ) TEST_ERROR;
@@ -2299,8 +2307,8 @@ check_dataset_write_tags(void)
     if ( verbose ) dump_cache(fid);
 #endif /* NDEBUG */ /* end debugging functions */
  
-    /* Verify 10 b-tree nodes belonging to dataset  */
-    for (i=0; i<10; i++)
+    /* Verify 19 b-tree nodes belonging to dataset  */
+    for (i=0; i<19; i++)
         if ( verify_tag(fid, H5AC_BT_ID, d_tag) < 0 ) TEST_ERROR;
 
     /* Verify object header for dataset */
@@ -60,6 +60,16 @@ const char *FILENAME[] = {
     "storage_size",     /* 22 */
     "dls_01_strings",   /* 23 */
     "power2up",         /* 24 */
+    "shared_chunk_cache", /* 25 */
+    "chunk_cache_policy", /* 26 */
+    "chunk_cache_hash", /* 27 */
+    "filter_nthreads",  /* 28 */
+    "filter_nthreads_write", /* 29 */
+    "chunk_prefetch",   /* 30 */
+    "read_chunks",      /* 31 */
+    "write_chunks",     /* 32 */
+    "chunk_addr_cache", /* 33 */
+    "regular_chunk_map", /* 34 */
     NULL
 };
 #define FILENAME_BUF_SIZE       1024
@@ -154,6 +164,7 @@ const char *FILENAME[] = {
 #define H5Z_FILTER_EXPAND            310
 #define H5Z_FILTER_CAN_APPLY_TEST2   311
 #define H5Z_FILTER_COUNT             312
+#define H5Z_FILTER_API_CALL          313
 
 /* Flags for testing filters */
 #define DISABLE_FLETCHER32      0
@@ -279,6 +290,8 @@ static size_t filter_expand(unsigned int flags, size_t cd_nelmts,
         const unsigned int *cd_values, size_t nbytes, size_t *buf_size, void **buf);
 static size_t filter_count(unsigned int flags, size_t cd_nelmts,
         const unsigned int *cd_values, size_t nbytes, size_t *buf_size, void **buf);
+static size_t filter_api_call(unsigned int flags, size_t cd_nelmts,
+        const unsigned int *cd_values, size_t nbytes, size_t *buf_size, void **buf);
 
 /* This message derives from H5Z */
 const H5Z_class2_t H5Z_COUNT[1] = {{
@@ -316,6 +329,42 @@ filter_count(unsigned int flags, size_t H5_ATTR_UNUSED cd_nelmts,
     return nbytes;
 }
 
+/* This message derives from H5Z */
+const H5Z_class2_t H5Z_API_CALL[1] = {{
+    H5Z_CLASS_T_VERS,           /* H5Z_class_t version */
+    H5Z_FILTER_API_CALL,        /* Filter id number */
+    1, 1,                       /* Encoding and decoding enabled */
+    "api_call",                 /* Filter name for debugging */
+    NULL,                       /* The "can apply" callback */
+    NULL,                       /* The "set local" callback */
+    filter_api_call,            /* The actual filter function */
+}};
+
+
+/*-------------------------------------------------------------------------
+ * Function:    filter_api_call
+ *
+ * Purpose:     A filter that leaves the data alone but calls the library,
+ *              counting the bytes read like filter_count.
+ *
+ * Return:      Success:        Data chunk size
+ *              Failure:        0
+ *-------------------------------------------------------------------------
+ */
+static size_t
+filter_api_call(unsigned int flags, size_t H5_ATTR_UNUSED cd_nelmts,
+      const unsigned int H5_ATTR_UNUSED *cd_values, size_t nbytes,
+      size_t H5_ATTR_UNUSED *buf_size, void H5_ATTR_UNUSED **buf)
+{
+    if(H5Zfilter_avail(H5Z_FILTER_API_CALL) <= 0)
+        return 0;
+
+    if(flags & H5Z_FLAG_REVERSE)
+        count_nbytes_read += nbytes;
+
+    return nbytes;
+}
+
 
 /*-------------------------------------------------------------------------
  * Function:  test_create
@@ -7808,6 +7857,1599 @@ error:
     return -1;
 } /* end test_chunk_cache() */
 
+
+/*-------------------------------------------------------------------------
+ * Function: test_shared_chunk_cache
+ *
+ * Purpose: Tests the file-wide raw data chunk cache shared by all the
+ *          datasets in a file: that the byte budget is enforced across
+ *          datasets, that chunks of other datasets are preempted (and
+ *          flushed) in LRU order, that a per-dataset byte size on a
+ *          DAPL caps the dataset's share of the cache, and that chunks
+ *          are flushed through a handle which is still open.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define SHARED_CACHE_NCHUNKS    10
+#define SHARED_CACHE_CHUNK_DIM  10
+#define SHARED_CACHE_BUDGET     4
+static herr_t
+test_shared_chunk_cache(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       fapl_local = -1; /* Local fapl */
+    hid_t       fapl_file = -1; /* Fapl retrieved from file */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid1 = -1, dsid2 = -1, dsid3 = -1; /* Dataset IDs */
+    hsize_t     dim, chunk_dim; /* Dataset and chunk dimensions */
+    size_t      chunk_nbytes = SHARED_CACHE_CHUNK_DIM * sizeof(int);
+    size_t      nbytes, shared_nbytes, shared_nused;
+    int         nused;
+    int         wbuf[SHARED_CACHE_NCHUNKS * SHARED_CACHE_CHUNK_DIM];
+    int         wbuf2[SHARED_CACHE_NCHUNKS * SHARED_CACHE_CHUNK_DIM];
+    int         rbuf[SHARED_CACHE_NCHUNKS * SHARED_CACHE_CHUNK_DIM];
+    unsigned    u;
+
+    TESTING("file-wide shared chunk cache");
+
+    for(u = 0; u < SHARED_CACHE_NCHUNKS * SHARED_CACHE_CHUNK_DIM; u++) {
+        wbuf[u] = (int)u;
+        wbuf2[u] = -(int)u;
+    } /* end for */
+
+    /* Enable the shared cache, with room for a few chunks */
+    if((fapl_local = H5Pcopy(fapl)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_shared_chunk_cache(fapl_local, &nbytes) < 0) FAIL_STACK_ERROR
+    if(nbytes != 0)
+        FAIL_PUTS_ERROR("    shared chunk cache should be disabled by default.")
+    if(H5Pset_shared_chunk_cache(fapl_local, SHARED_CACHE_BUDGET * chunk_nbytes) < 0) FAIL_STACK_ERROR
+
+    h5_fixname(FILENAME[25], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_local)) < 0) FAIL_STACK_ERROR
+
+    /* Verify the budget is reported by the file's fapl */
+    if((fapl_file = H5Fget_access_plist(fid)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_shared_chunk_cache(fapl_file, &nbytes) < 0) FAIL_STACK_ERROR
+    if(nbytes != SHARED_CACHE_BUDGET * chunk_nbytes)
+        FAIL_PUTS_ERROR("    shared chunk cache size from file's fapl is wrong.")
+    if(H5Pclose(fapl_file) < 0) FAIL_STACK_ERROR
+
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    chunk_dim = SHARED_CACHE_CHUNK_DIM;
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    dim = SHARED_CACHE_NCHUNKS * SHARED_CACHE_CHUNK_DIM;
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+
+    if((dsid1 = H5Dcreate2(fid, "dset1", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+    if((dsid2 = H5Dcreate2(fid, "dset2", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0)
+        FAIL_STACK_ERROR
+
+    /* Fill the first dataset: it may use the whole shared budget */
+    if(H5Dwrite(dsid1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5D__current_cache_size_test(dsid1, &nbytes, &nused) < 0) FAIL_STACK_ERROR
+    if(nused != SHARED_CACHE_BUDGET || nbytes != SHARED_CACHE_BUDGET * chunk_nbytes)
+        FAIL_PUTS_ERROR("    first dataset should fill the shared cache.")
+
+    /* Writing the second dataset must preempt (and flush) the first's chunks */
+    if(H5Dwrite(dsid2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5D__current_cache_size_test(dsid1, &nbytes, &nused) < 0) FAIL_STACK_ERROR
+    if(nused != 0 || nbytes != 0)
+        FAIL_PUTS_ERROR("    first dataset's chunks should have been preempted.")
+    if(H5D__current_cache_size_test(dsid2, &nbytes, &nused) < 0) FAIL_STACK_ERROR
+    if(nused != SHARED_CACHE_BUDGET)
+        FAIL_PUTS_ERROR("    second dataset should fill the shared cache.")
+    if(H5D__shared_cache_size_test(dsid2, &shared_nbytes, &shared_nused) < 0) FAIL_STACK_ERROR
+    if(shared_nused != SHARED_CACHE_BUDGET || shared_nbytes != SHARED_CACHE_BUDGET * chunk_nbytes)
+        FAIL_PUTS_ERROR("    shared cache usage is wrong.")
+
+    /* Verify the data of both datasets (the first one was flushed by the
+     * second one's preemptions) */
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(wbuf, rbuf, sizeof(wbuf)))
+        FAIL_PUTS_ERROR("    first dataset's data is wrong.")
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(wbuf, rbuf, sizeof(wbuf)))
+        FAIL_PUTS_ERROR("    second dataset's data is wrong.")
+
+    /* A byte size on the DAPL caps a dataset's share of the cache */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, H5D_CHUNK_CACHE_NSLOTS_DEFAULT, 2 * chunk_nbytes, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        FAIL_STACK_ERROR
+    if((dsid3 = H5Dcreate2(fid, "dset3", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0)
+        FAIL_STACK_ERROR
+    if(H5Dwrite(dsid3, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5D__current_cache_size_test(dsid3, &nbytes, &nused) < 0) FAIL_STACK_ERROR
+    if(nused != 2)
+        FAIL_PUTS_ERROR("    DAPL byte size should cap the dataset's share of the cache.")
+    if(H5D__shared_cache_size_test(dsid3, &shared_nbytes, &shared_nused) < 0) FAIL_STACK_ERROR
+    if(shared_nused > SHARED_CACHE_BUDGET || shared_nbytes > SHARED_CACHE_BUDGET * chunk_nbytes)
+        FAIL_PUTS_ERROR("    shared cache budget exceeded.")
+
+    /* Closing a dataset releases its share of the cache */
+    if(H5Dclose(dsid3) < 0) FAIL_STACK_ERROR
+    if(H5D__shared_cache_size_test(dsid2, &shared_nbytes, &shared_nused) < 0) FAIL_STACK_ERROR
+    if(H5D__current_cache_size_test(dsid2, &nbytes, &nused) < 0) FAIL_STACK_ERROR
+    if(shared_nused != (size_t)nused || shared_nbytes != nbytes)
+        FAIL_PUTS_ERROR("    closed dataset's chunks still counted in shared cache.")
+
+    /* Closing the handle a dataset's chunks are flushed through, while
+     * another handle keeps the dataset open, flushes the chunks, and
+     * later preemptions flush them through the other handle */
+    if((dsid3 = H5Dopen2(fid, "dset1", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid1) < 0) FAIL_STACK_ERROR
+    dsid1 = dsid3;
+    dsid3 = -1;
+    if(H5D__current_cache_size_test(dsid1, &nbytes, &nused) < 0) FAIL_STACK_ERROR
+    if(nused != 0 || nbytes != 0)
+        FAIL_PUTS_ERROR("    closed handle's chunks should have been flushed.")
+    if(H5Dwrite(dsid1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf2) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5D__current_cache_size_test(dsid1, &nbytes, &nused) < 0) FAIL_STACK_ERROR
+    if(nused != 0 || nbytes != 0)
+        FAIL_PUTS_ERROR("    first dataset's chunks should have been preempted.")
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(wbuf2, rbuf, sizeof(wbuf2)))
+        FAIL_PUTS_ERROR("    first dataset's data is wrong after reopening.")
+
+    /* Close */
+    if(H5Dclose(dsid1) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid2) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(fapl_local) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    /* Re-open the file and verify the data again */
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) FAIL_STACK_ERROR
+    if((dsid1 = H5Dopen2(fid, "dset3", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid1, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(wbuf, rbuf, sizeof(wbuf)))
+        FAIL_PUTS_ERROR("    third dataset's data is wrong.")
+    if(H5Dclose(dsid1) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(fapl_local);
+        H5Pclose(fapl_file);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Dclose(dsid1);
+        H5Dclose(dsid2);
+        H5Dclose(dsid3);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_shared_chunk_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: read_policy_chunks
+ *
+ * Purpose: Helper for test_chunk_cache_policy: reads chunks START through
+ *          END-1 of the dataset, one chunk per H5Dread call.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define POLICY_NCHUNKS          20
+#define POLICY_CHUNK_DIM        10
+#define POLICY_CACHE_NCHUNKS    8
+static herr_t
+read_policy_chunks(hid_t did, hid_t fsid, unsigned start, unsigned end)
+{
+    hid_t       msid = -1;              /* Memory dataspace ID */
+    hsize_t     hs_start, hs_count;     /* Hyperslab selection */
+    int         buf[POLICY_CHUNK_DIM];  /* Chunk read buffer */
+    unsigned    u;
+
+    hs_count = POLICY_CHUNK_DIM;
+    if((msid = H5Screate_simple(1, &hs_count, NULL)) < 0) TEST_ERROR
+    for(u = start; u < end; u++) {
+        hs_start = (hsize_t)u * POLICY_CHUNK_DIM;
+        if(H5Sselect_hyperslab(fsid, H5S_SELECT_SET, &hs_start, NULL, &hs_count, NULL) < 0) TEST_ERROR
+        if(H5Dread(did, H5T_NATIVE_INT, msid, fsid, H5P_DEFAULT, buf) < 0) TEST_ERROR
+        if(buf[0] != (int)hs_start) TEST_ERROR
+    } /* end for */
+    if(H5Sclose(msid) < 0) TEST_ERROR
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(msid);
+    } H5E_END_TRY;
+    return -1;
+} /* end read_policy_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_cache_policy
+ *
+ * Purpose: Tests the chunk cache replacement policy property, and that
+ *          with the 2Q policy a full scan of a dataset does not preempt
+ *          chunks that are in frequent use, while it does with the
+ *          default LRU policy.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_cache_policy(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       dapl2 = -1;     /* Dataset access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dim, chunk_dim; /* Dataset and chunk dimensions */
+    H5D_chunk_cache_policy_t policy;    /* Chunk cache replacement policy */
+    int         wbuf[POLICY_NCHUNKS * POLICY_CHUNK_DIM];
+    unsigned    u;
+
+    TESTING("chunk cache replacement policy");
+
+    for(u = 0; u < POLICY_NCHUNKS * POLICY_CHUNK_DIM; u++)
+        wbuf[u] = (int)u;
+
+    /* Check the property */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache_policy(dapl, &policy) < 0) FAIL_STACK_ERROR
+    if(policy != H5D_CHUNK_CACHE_POLICY_LRU)
+        FAIL_PUTS_ERROR("    default chunk cache policy should be LRU.")
+    H5E_BEGIN_TRY {
+        if(H5Pset_chunk_cache_policy(dapl, (H5D_chunk_cache_policy_t)7) >= 0)
+            FAIL_PUTS_ERROR("    invalid chunk cache policy accepted.")
+    } H5E_END_TRY;
+    if(H5Pset_chunk_cache_policy(dapl, H5D_CHUNK_CACHE_POLICY_2Q) < 0) FAIL_STACK_ERROR
+
+    /* Room for a few chunks, with enough slots to avoid hash collisions */
+    if(H5Pset_chunk_cache(dapl, (size_t)101, POLICY_CACHE_NCHUNKS * POLICY_CHUNK_DIM * sizeof(int), H5D_CHUNK_CACHE_W0_DEFAULT) < 0) FAIL_STACK_ERROR
+
+    /* Create a dataset with the counting filter, to count chunk reads */
+    if(H5Zregister(H5Z_COUNT) < 0) FAIL_STACK_ERROR
+    h5_fixname(FILENAME[26], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    chunk_dim = POLICY_CHUNK_DIM;
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if(H5Pset_filter(dcpl, H5Z_FILTER_COUNT, 0, (size_t)0, NULL) < 0) FAIL_STACK_ERROR
+    dim = POLICY_NCHUNKS * POLICY_CHUNK_DIM;
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    /* The policy is reported by the dataset's access property list */
+    if((dapl2 = H5Dget_access_plist(dsid)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_cache_policy(dapl2, &policy) < 0) FAIL_STACK_ERROR
+    if(policy != H5D_CHUNK_CACHE_POLICY_2Q)
+        FAIL_PUTS_ERROR("    wrong chunk cache policy reported for dataset.")
+    if(H5Pclose(dapl2) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Run the same access pattern with each policy, starting from an empty
+     * cache: make chunks 0 and 1 hot by accessing them, pushing them out
+     * with other chunks and accessing them again, then scan the rest of
+     * the dataset.  Only 2Q should still have the hot chunks cached
+     * afterwards.
+     */
+    for(policy = H5D_CHUNK_CACHE_POLICY_LRU; policy <= H5D_CHUNK_CACHE_POLICY_2Q; policy = (H5D_chunk_cache_policy_t)(policy + 1)) {
+        if(H5Pset_chunk_cache_policy(dapl, policy) < 0) FAIL_STACK_ERROR
+        if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+
+        if(read_policy_chunks(dsid, sid, 0, 2) < 0) TEST_ERROR
+        if(read_policy_chunks(dsid, sid, 2, POLICY_CACHE_NCHUNKS + 2) < 0) TEST_ERROR
+        if(read_policy_chunks(dsid, sid, 0, 2) < 0) TEST_ERROR
+        if(read_policy_chunks(dsid, sid, POLICY_CACHE_NCHUNKS + 2, POLICY_NCHUNKS) < 0) TEST_ERROR
+
+        count_nbytes_read = 0;
+        if(read_policy_chunks(dsid, sid, 0, 2) < 0) TEST_ERROR
+        if(H5D_CHUNK_CACHE_POLICY_2Q == policy) {
+            if(count_nbytes_read != 0)
+                FAIL_PUTS_ERROR("    hot chunks were preempted by a scan with 2Q.")
+        } /* end if */
+        else
+            if(count_nbytes_read != 2 * POLICY_CHUNK_DIM * sizeof(int))
+                FAIL_PUTS_ERROR("    hot chunks were not preempted by a scan with LRU.")
+
+        if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    } /* end for */
+
+    /* Close */
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dapl);
+        H5Pclose(dapl2);
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_cache_policy() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_cache_hash
+ *
+ * Purpose: Tests that the chunk cache hash table grows with the number of
+ *          cached chunks: chunks are not preempted by hash collisions even
+ *          with a single hash slot requested, and cached chunks are still
+ *          found after extending the dataset changes their hash values.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define HASH_NCHUNKS    40
+#define HASH_CHUNK_DIM  4
+static herr_t
+test_chunk_cache_hash(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2], max_dims[2], chunk_dims[2];    /* Dataset and chunk dimensions */
+    size_t      chunk_nbytes = HASH_CHUNK_DIM * HASH_CHUNK_DIM * sizeof(int);
+    size_t      nbytes;
+    int         nused;
+    int         wbuf[HASH_CHUNK_DIM][HASH_NCHUNKS * HASH_CHUNK_DIM];
+    int         rbuf[HASH_CHUNK_DIM][HASH_NCHUNKS * HASH_CHUNK_DIM];
+    unsigned    u, v;
+
+    TESTING("chunk cache hash table growth");
+
+    for(u = 0; u < HASH_CHUNK_DIM; u++)
+        for(v = 0; v < HASH_NCHUNKS * HASH_CHUNK_DIM; v++)
+            wbuf[u][v] = (int)(u * 1000 + v);
+
+    /* One hash slot, and room for all the chunks */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)1, HASH_NCHUNKS * chunk_nbytes, H5D_CHUNK_CACHE_W0_DEFAULT) < 0) FAIL_STACK_ERROR
+
+    /* A row of chunks in an extendible dataset */
+    h5_fixname(FILENAME[27], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    chunk_dims[0] = chunk_dims[1] = HASH_CHUNK_DIM;
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    dims[0] = HASH_CHUNK_DIM;
+    dims[1] = HASH_NCHUNKS * HASH_CHUNK_DIM;
+    max_dims[0] = max_dims[1] = H5S_UNLIMITED;
+    if((sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+
+    /* All chunks written stay cached */
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5D__current_cache_size_test(dsid, &nbytes, &nused) < 0) FAIL_STACK_ERROR
+    if(nused != HASH_NCHUNKS || nbytes != HASH_NCHUNKS * chunk_nbytes)
+        FAIL_PUTS_ERROR("    chunks were preempted by hash collisions.")
+
+    /* Extend the dataset, so the scaled dimensions need more bits */
+    dims[0] = 64 * HASH_CHUNK_DIM;
+    dims[1] = 64 * HASH_NCHUNKS * HASH_CHUNK_DIM;
+    if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+    if(H5D__current_cache_size_test(dsid, &nbytes, &nused) < 0) FAIL_STACK_ERROR
+    if(nused != HASH_NCHUNKS)
+        FAIL_PUTS_ERROR("    chunks were preempted when the dataset was extended.")
+
+    /* The (still dirty) cached chunks are found and read back */
+    if((sid = H5Dget_space(dsid)) < 0) FAIL_STACK_ERROR
+    dims[0] = HASH_CHUNK_DIM;
+    dims[1] = HASH_NCHUNKS * HASH_CHUNK_DIM;
+    chunk_dims[0] = chunk_dims[1] = 0;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, chunk_dims, NULL, dims, NULL) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(wbuf, rbuf, sizeof(wbuf)))
+        FAIL_PUTS_ERROR("    data read from cached chunks is wrong.")
+    if(H5D__current_cache_size_test(dsid, &nbytes, &nused) < 0) FAIL_STACK_ERROR
+    if(nused != HASH_NCHUNKS)
+        FAIL_PUTS_ERROR("    cached chunks were not found after extending the dataset.")
+
+    /* Close */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_cache_hash() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_filter_nthreads
+ *
+ * Purpose: Tests reading a filtered dataset with several threads running
+ *          the filter pipeline: the data must be the same with and without
+ *          the chunk cache, for partial selections, and for partial edge
+ *          chunks whose filters are disabled.  Chunks with wrong
+ *          checksums must fail the read on this thread, and an application
+ *          filter that calls the library must still work.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define NTHREADS_NCHUNKS        25
+#define NTHREADS_CHUNK_DIM      100
+#define NTHREADS_DIM            (NTHREADS_NCHUNKS * NTHREADS_CHUNK_DIM - 50)
+static herr_t
+test_filter_nthreads(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       dxpl = -1;      /* Dataset transfer property list ID */
+    hid_t       wdxpl = -1;     /* Dataset transfer property list ID for raw chunk writes */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dim, chunk_dim; /* Dataset and chunk dimensions */
+    hsize_t     start, count;   /* Hyperslab selection */
+    hsize_t     chunk_offset;   /* Offset of a raw chunk */
+    hsize_t     *chunk_offset_ptr = &chunk_offset;
+    hbool_t     direct_write = TRUE;
+    uint32_t    chunk_filters = 0;
+    uint32_t    chunk_nbytes = NTHREADS_CHUNK_DIM * sizeof(int) + 4;
+    unsigned    nthreads;
+    int         wbuf[NTHREADS_DIM];
+    int         rbuf[NTHREADS_DIM];
+    herr_t      ret;
+    unsigned    u;
+
+    TESTING("reading chunks with several filter threads");
+
+    for(u = 0; u < NTHREADS_DIM; u++)
+        wbuf[u] = (int)u;
+
+    /* Check the property */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_filter_nthreads(dxpl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 1)
+        FAIL_PUTS_ERROR("    default number of filter threads should be 1.")
+    H5E_BEGIN_TRY {
+        if(H5Pset_filter_nthreads(dxpl, 0) >= 0)
+            FAIL_PUTS_ERROR("    zero filter threads accepted.")
+    } H5E_END_TRY;
+    if(H5Pset_filter_nthreads(dxpl, 4) < 0) FAIL_STACK_ERROR
+    if(H5Pget_filter_nthreads(dxpl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 4)
+        FAIL_PUTS_ERROR("    wrong number of filter threads.")
+
+    /* Create a filtered dataset with an unfiltered partial edge chunk */
+    h5_fixname(FILENAME[28], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    chunk_dim = NTHREADS_CHUNK_DIM;
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_opts(dcpl, H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS) < 0) FAIL_STACK_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+    dim = NTHREADS_DIM;
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Read everything through the chunk cache, twice */
+    if((dsid = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(wbuf, rbuf, sizeof(wbuf)))
+        FAIL_PUTS_ERROR("    wrong data read through the chunk cache.")
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(wbuf, rbuf, sizeof(wbuf)))
+        FAIL_PUTS_ERROR("    wrong data read from cached chunks.")
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Read a selection that starts and ends inside chunks, without a cache */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_cache(dapl, (size_t)0, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+    start = NTHREADS_CHUNK_DIM + NTHREADS_CHUNK_DIM / 2;
+    count = NTHREADS_DIM - start - 10;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(1, &count, NULL)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, msid, sid, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(wbuf + start, rbuf, (size_t)count * sizeof(int)))
+        FAIL_PUTS_ERROR("    wrong data read without the chunk cache.")
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Read chunks whose checksums are wrong, so that the pipeline fails on
+     * every thread; the errors must only be reported on this thread */
+    if((dsid = H5Dcreate2(fid, "dset_corrupt", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((wdxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pset(wdxpl, H5D_XFER_DIRECT_CHUNK_WRITE_FLAG_NAME, &direct_write) < 0) FAIL_STACK_ERROR
+    if(H5Pset(wdxpl, H5D_XFER_DIRECT_CHUNK_WRITE_FILTERS_NAME, &chunk_filters) < 0) FAIL_STACK_ERROR
+    if(H5Pset(wdxpl, H5D_XFER_DIRECT_CHUNK_WRITE_DATASIZE_NAME, &chunk_nbytes) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 1, sizeof(rbuf));
+    rbuf[NTHREADS_CHUNK_DIM] = 0;
+    for(u = 0; u < NTHREADS_NCHUNKS - 1; u++) {
+        chunk_offset = (hsize_t)u * NTHREADS_CHUNK_DIM;
+        if(H5Pset(wdxpl, H5D_XFER_DIRECT_CHUNK_WRITE_OFFSET_NAME, &chunk_offset_ptr) < 0) FAIL_STACK_ERROR
+        if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, wdxpl, rbuf) < 0) FAIL_STACK_ERROR
+    } /* end for */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset_corrupt", dapl)) < 0) FAIL_STACK_ERROR
+    H5E_BEGIN_TRY {
+        ret = H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("    chunks with wrong checksums read.")
+    if(H5Eget_num(H5E_DEFAULT) <= 0)
+        FAIL_PUTS_ERROR("    no error reported for chunks with wrong checksums.")
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Read a dataset whose pipeline has a filter that calls the library,
+     * which is locked by this thread */
+    if(H5Zregister(H5Z_API_CALL) < 0) FAIL_STACK_ERROR
+    if(H5Pset_filter(dcpl, H5Z_FILTER_API_CALL, 0, (size_t)0, NULL) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset_api_call", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Sselect_all(sid) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset_api_call", dapl)) < 0) FAIL_STACK_ERROR
+    count_nbytes_read = 0;
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(wbuf, rbuf, sizeof(wbuf)))
+        FAIL_PUTS_ERROR("    wrong data read through a filter calling the library.")
+    /* The filter sees each full chunk with its fletcher32 checksum */
+    if(count_nbytes_read != (NTHREADS_NCHUNKS - 1) * (NTHREADS_CHUNK_DIM * sizeof(int) + 4))
+        FAIL_PUTS_ERROR("    filter calling the library not run on every full chunk.")
+
+    /* Close */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Zunregister(H5Z_FILTER_API_CALL) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(wdxpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dapl);
+        H5Pclose(wdxpl);
+        H5Pclose(dxpl);
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_filter_nthreads() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_filter_nthreads_write
+ *
+ * Purpose: Tests writing a filtered dataset with several threads running
+ *          the filter pipeline, set with H5Pset_chunk_flush_nthreads,
+ *          when chunks are preempted from a small chunk cache, flushed
+ *          and written back at close.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_filter_nthreads_write(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       dapl2 = -1;     /* Dataset's access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dim, chunk_dim; /* Dataset and chunk dimensions */
+    hsize_t     start, count;   /* Hyperslab selection */
+    int         wbuf[NTHREADS_DIM];
+    int         rbuf[NTHREADS_DIM];
+    unsigned    nthreads;       /* Number of write back threads */
+    herr_t      ret;            /* Generic return value */
+    unsigned    u;
+
+    TESTING("writing chunks with several filter threads");
+
+    for(u = 0; u < NTHREADS_DIM; u++)
+        wbuf[u] = (int)u;
+
+    /* Check the property */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_flush_nthreads(dapl, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 1)
+        FAIL_PUTS_ERROR("    wrong default number of write back threads.")
+    H5E_BEGIN_TRY {
+        ret = H5Pset_chunk_flush_nthreads(dapl, 0);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("    zero write back threads should fail.")
+    if(H5Pset_chunk_flush_nthreads(dapl, 4) < 0) FAIL_STACK_ERROR
+
+    /* Room for a few chunks only, so chunks are preempted while writing */
+    if(H5Pset_chunk_cache(dapl, (size_t)101, 6 * NTHREADS_CHUNK_DIM * sizeof(int), H5D_CHUNK_CACHE_W0_DEFAULT) < 0) FAIL_STACK_ERROR
+
+    /* Create a filtered dataset with an unfiltered partial edge chunk */
+    h5_fixname(FILENAME[29], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    chunk_dim = NTHREADS_CHUNK_DIM;
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_opts(dcpl, H5D_CHUNK_DONT_FILTER_PARTIAL_CHUNKS) < 0) FAIL_STACK_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+    dim = NTHREADS_DIM;
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    /* The thread count is reported by the dataset's access property list */
+    if((dapl2 = H5Dget_access_plist(dsid)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_flush_nthreads(dapl2, &nthreads) < 0) FAIL_STACK_ERROR
+    if(nthreads != 4)
+        FAIL_PUTS_ERROR("    wrong number of write back threads reported for dataset.")
+    if(H5Pclose(dapl2) < 0) FAIL_STACK_ERROR
+
+    /* Overwrite part of the dataset and flush it */
+    start = NTHREADS_CHUNK_DIM / 2;
+    count = 4 * NTHREADS_CHUNK_DIM;
+    for(u = 0; u < count; u++)
+        wbuf[start + u] = -(int)u;
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(1, &count, NULL)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, wbuf + start) < 0) FAIL_STACK_ERROR
+    if(H5Dflush(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Overwrite the end of the dataset, written back when it's closed */
+    start = NTHREADS_DIM - count;
+    for(u = 0; u < count; u++)
+        wbuf[start + u] = (int)(u * 3);
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, &start, NULL, &count, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, wbuf + start) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Read everything back */
+    if((dsid = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(wbuf, rbuf, sizeof(wbuf)))
+        FAIL_PUTS_ERROR("    wrong data written with several filter threads.")
+
+    /* Close */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dapl2);
+        H5Pclose(dapl);
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_filter_nthreads_write() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: read_prefetch_chunks
+ *
+ * Purpose: Helper for test_chunk_prefetch: reads chunks START, START +
+ *          STRIDE, ... up to END-1 of the dataset, one chunk per H5Dread
+ *          call, and checks the count of bytes read from the file.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define PREFETCH_NCHUNKS        20
+#define PREFETCH_CHUNK_DIM      10
+#define PREFETCH_AHEAD          4
+static herr_t
+read_prefetch_chunks(hid_t did, hid_t fsid, hid_t dxpl, unsigned start,
+    unsigned stride, unsigned end, size_t nchunks_read)
+{
+    hid_t       msid = -1;              /* Memory dataspace ID */
+    hsize_t     hs_start, hs_count;     /* Hyperslab selection */
+    int         buf[PREFETCH_CHUNK_DIM]; /* Chunk read buffer */
+    unsigned    u;
+
+    count_nbytes_read = 0;
+    hs_count = PREFETCH_CHUNK_DIM;
+    if((msid = H5Screate_simple(1, &hs_count, NULL)) < 0) TEST_ERROR
+    for(u = start; u < end; u += stride) {
+        hs_start = (hsize_t)u * PREFETCH_CHUNK_DIM;
+        if(H5Sselect_hyperslab(fsid, H5S_SELECT_SET, &hs_start, NULL, &hs_count, NULL) < 0) TEST_ERROR
+        if(H5Dread(did, H5T_NATIVE_INT, msid, fsid, dxpl, buf) < 0) TEST_ERROR
+        if(buf[0] != (int)hs_start || buf[PREFETCH_CHUNK_DIM - 1] != (int)hs_start + PREFETCH_CHUNK_DIM - 1) TEST_ERROR
+    } /* end for */
+    if(H5Sclose(msid) < 0) TEST_ERROR
+    if(count_nbytes_read != nchunks_read * PREFETCH_CHUNK_DIM * sizeof(int)) TEST_ERROR
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Sclose(msid);
+    } H5E_END_TRY;
+    return -1;
+} /* end read_prefetch_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_prefetch
+ *
+ * Purpose: Tests the chunk read-ahead property, and that chunks are read
+ *          ahead once reads follow a constant stride, and only then.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_chunk_prefetch(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       dapl2 = -1;     /* Dataset access property list ID */
+    hid_t       dxpl = -1;      /* Dataset transfer property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dim, chunk_dim; /* Dataset and chunk dimensions */
+    size_t      nchunks;        /* Number of chunks to read ahead */
+    int         wbuf[PREFETCH_NCHUNKS * PREFETCH_CHUNK_DIM];
+    unsigned    u;
+
+    TESTING("chunk read-ahead");
+
+    for(u = 0; u < PREFETCH_NCHUNKS * PREFETCH_CHUNK_DIM; u++)
+        wbuf[u] = (int)u;
+
+    /* Check the property */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_prefetch(dapl, &nchunks) < 0) FAIL_STACK_ERROR
+    if(nchunks != 0)
+        FAIL_PUTS_ERROR("    chunk read-ahead should be disabled by default.")
+    if(H5Pset_chunk_prefetch(dapl, (size_t)PREFETCH_AHEAD) < 0) FAIL_STACK_ERROR
+
+    /* Room for all the chunks */
+    if(H5Pset_chunk_cache(dapl, (size_t)101, PREFETCH_NCHUNKS * PREFETCH_CHUNK_DIM * sizeof(int), H5D_CHUNK_CACHE_W0_DEFAULT) < 0) FAIL_STACK_ERROR
+
+    /* Create a dataset with the counting filter, to count chunk reads */
+    if(H5Zregister(H5Z_COUNT) < 0) FAIL_STACK_ERROR
+    h5_fixname(FILENAME[30], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    chunk_dim = PREFETCH_CHUNK_DIM;
+    if(H5Pset_chunk(dcpl, 1, &chunk_dim) < 0) FAIL_STACK_ERROR
+    if(H5Pset_filter(dcpl, H5Z_FILTER_COUNT, 0, (size_t)0, NULL) < 0) FAIL_STACK_ERROR
+    dim = PREFETCH_NCHUNKS * PREFETCH_CHUNK_DIM;
+    if((sid = H5Screate_simple(1, &dim, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    /* The read-ahead is reported by the dataset's access property list */
+    if((dapl2 = H5Dget_access_plist(dsid)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_prefetch(dapl2, &nchunks) < 0) FAIL_STACK_ERROR
+    if(nchunks != PREFETCH_AHEAD)
+        FAIL_PUTS_ERROR("    wrong chunk read-ahead reported for dataset.")
+    if(H5Pclose(dapl2) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Once every other chunk was read three times, the next chunks along
+     * that stride are read ahead, and each read that continues the pattern
+     * reads one more chunk ahead, up to the end of the dataset.  A read
+     * that breaks the pattern doesn't read ahead.
+     */
+    if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+    if(read_prefetch_chunks(dsid, sid, H5P_DEFAULT, 0, 2, 6, (size_t)(3 + PREFETCH_AHEAD)) < 0)
+        FAIL_PUTS_ERROR("    wrong number of chunks read ahead.")
+    if(read_prefetch_chunks(dsid, sid, H5P_DEFAULT, 6, 2, 14, (size_t)3) < 0)
+        FAIL_PUTS_ERROR("    wrong number of chunks read ahead while continuing the stride.")
+    if(read_prefetch_chunks(dsid, sid, H5P_DEFAULT, 1, 1, 2, (size_t)1) < 0)
+        FAIL_PUTS_ERROR("    chunks read ahead after the stride changed.")
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Read ahead with several filter threads */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_filter_nthreads(dxpl, 2) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+    if(read_prefetch_chunks(dsid, sid, dxpl, 0, 1, 3, (size_t)(3 + PREFETCH_AHEAD)) < 0)
+        FAIL_PUTS_ERROR("    wrong number of chunks read ahead with several filter threads.")
+    if(read_prefetch_chunks(dsid, sid, dxpl, 3, 1, 3 + PREFETCH_AHEAD, (size_t)PREFETCH_AHEAD) < 0)
+        FAIL_PUTS_ERROR("    wrong data read ahead with several filter threads.")
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Close */
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dxpl);
+        H5Pclose(dapl);
+        H5Pclose(dapl2);
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_prefetch() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: check_read_chunks
+ *
+ * Purpose: Helper for test_read_chunks: reads the chunks at OFFSETS with
+ *          H5Dread_chunks() and compares them with the chunks in REF,
+ *          read one by one with H5Dread().  Chunks that don't exist have
+ *          a size of zero in REF_NBYTES and their buffers must be left
+ *          alone.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define READ_CHUNKS_DIM0        16
+#define READ_CHUNKS_DIM1        16
+#define READ_CHUNKS_CDIM0       2
+#define READ_CHUNKS_CDIM1       4
+#define READ_CHUNKS_NCHUNKS     ((READ_CHUNKS_DIM0 / READ_CHUNKS_CDIM0) * (READ_CHUNKS_DIM1 / READ_CHUNKS_CDIM1))
+#define READ_CHUNKS_BUF_SIZE    64
+static herr_t
+check_read_chunks(hid_t did, size_t nchunks, const hsize_t *offsets,
+    unsigned char ref[][READ_CHUNKS_BUF_SIZE], const hsize_t *ref_nbytes)
+{
+    unsigned char bufs[READ_CHUNKS_NCHUNKS][READ_CHUNKS_BUF_SIZE];
+    void       *buf_ptrs[READ_CHUNKS_NCHUNKS];
+    uint32_t    filters[READ_CHUNKS_NCHUNKS];
+    hsize_t     nbytes[READ_CHUNKS_NCHUNKS];
+    size_t      u;
+
+    HDmemset(bufs, 0xAA, sizeof(bufs));
+    for(u = 0; u < nchunks; u++)
+        buf_ptrs[u] = bufs[u];
+    if(H5Dread_chunks(did, H5P_DEFAULT, nchunks, offsets, filters, nbytes, buf_ptrs) < 0)
+        TEST_ERROR
+
+    for(u = 0; u < nchunks; u++) {
+        size_t idx = (size_t)((offsets[2 * u] / READ_CHUNKS_CDIM0) * (READ_CHUNKS_DIM1 / READ_CHUNKS_CDIM1) + offsets[2 * u + 1] / READ_CHUNKS_CDIM1);
+        size_t v;
+
+        if(nbytes[u] != ref_nbytes[idx] || filters[u] != 0)
+            TEST_ERROR
+        if(HDmemcmp(bufs[u], ref[idx], (size_t)nbytes[u]))
+            TEST_ERROR
+        for(v = (size_t)nbytes[u]; v < READ_CHUNKS_BUF_SIZE; v++)
+            if(bufs[u][v] != 0xAA)
+                TEST_ERROR
+    } /* end for */
+
+    return 0;
+
+error:
+    return -1;
+} /* end check_read_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_read_chunks
+ *
+ * Purpose: Tests reading several raw chunks at once with H5Dread_chunks(),
+ *          for chunks that are still dirty in the chunk cache, chunks that
+ *          were never written, and chunks requested in any order and more
+ *          than once.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+test_read_chunks(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dxpl = -1;      /* Dataset transfer property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2] = {READ_CHUNKS_DIM0, READ_CHUNKS_DIM1};
+    hsize_t     chunk_dims[2] = {READ_CHUNKS_CDIM0, READ_CHUNKS_CDIM1};
+    hsize_t     start[2] = {0, 0};
+    hsize_t     count[2] = {READ_CHUNKS_DIM0 - 2 * READ_CHUNKS_CDIM0, READ_CHUNKS_DIM1};
+    hsize_t     all_offsets[2 * READ_CHUNKS_NCHUNKS];
+    hsize_t     dense_offsets[] = {6, 12,  0, 0,  14, 4,  2, 8,  0, 0,  10, 0,  4, 4,  12, 12,  8, 8,  0, 4};
+    hsize_t     sparse_offsets[] = {14, 0,  10, 12,  0, 4};
+    hsize_t     bad_offset[2] = {1, 0};
+    hsize_t     nbytes[READ_CHUNKS_NCHUNKS];
+    hsize_t     ref_nbytes[READ_CHUNKS_NCHUNKS];
+    uint32_t    filters[READ_CHUNKS_NCHUNKS];
+    unsigned char ref[READ_CHUNKS_NCHUNKS][READ_CHUNKS_BUF_SIZE];
+    int         wbuf[READ_CHUNKS_DIM0 * READ_CHUNKS_DIM1];
+    hsize_t    *direct_offset;
+    hbool_t     direct_read = TRUE;
+    herr_t      ret;
+    unsigned    u;
+
+    TESTING("reading several raw chunks at once");
+
+    for(u = 0; u < READ_CHUNKS_DIM0 * READ_CHUNKS_DIM1; u++)
+        wbuf[u] = (int)(u * 7);
+    for(u = 0; u < READ_CHUNKS_NCHUNKS; u++) {
+        all_offsets[2 * u] = (u / (READ_CHUNKS_DIM1 / READ_CHUNKS_CDIM1)) * READ_CHUNKS_CDIM0;
+        all_offsets[2 * u + 1] = (u % (READ_CHUNKS_DIM1 / READ_CHUNKS_CDIM1)) * READ_CHUNKS_CDIM1;
+    } /* end for */
+
+    /* Create a filtered dataset and write all but the last two rows of
+     * chunks, which stay dirty in the chunk cache
+     */
+    h5_fixname(FILENAME[31], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_INCR) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((msid = H5Screate_simple(2, count, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start, NULL, count, NULL) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    /* Query the sizes of all the chunks, which writes the dirty ones */
+    if(H5Dread_chunks(dsid, H5P_DEFAULT, (size_t)READ_CHUNKS_NCHUNKS, all_offsets, filters, nbytes, NULL) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < READ_CHUNKS_NCHUNKS; u++) {
+        if(filters[u] != 0)
+            FAIL_PUTS_ERROR("    wrong filter mask reported.")
+        ref_nbytes[u] = 0;
+        if(all_offsets[2 * u] < count[0]) {
+            if(H5Dget_chunk_storage_size(dsid, &all_offsets[2 * u], &ref_nbytes[u]) < 0) FAIL_STACK_ERROR
+            if(ref_nbytes[u] == 0 || ref_nbytes[u] > READ_CHUNKS_BUF_SIZE)
+                FAIL_PUTS_ERROR("    wrong chunk size reported.")
+        } /* end if */
+        if(nbytes[u] != ref_nbytes[u])
+            FAIL_PUTS_ERROR("    wrong chunk size reported.")
+    } /* end for */
+
+    /* Read the chunks one by one for reference */
+    if((dxpl = H5Pcreate(H5P_DATASET_XFER)) < 0) FAIL_STACK_ERROR
+    if(H5Pset(dxpl, H5D_XFER_DIRECT_CHUNK_READ_FLAG_NAME, &direct_read) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < READ_CHUNKS_NCHUNKS; u++)
+        if(ref_nbytes[u] > 0) {
+            direct_offset = &all_offsets[2 * u];
+            if(H5Pset(dxpl, H5D_XFER_DIRECT_CHUNK_READ_OFFSET_NAME, &direct_offset) < 0) FAIL_STACK_ERROR
+            if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl, ref[u]) < 0) FAIL_STACK_ERROR
+        } /* end if */
+
+    /* Read the chunks in any order, with a missing and a repeated chunk,
+     * both for lookups with one walk of the index and chunk by chunk
+     */
+    if(check_read_chunks(dsid, sizeof(dense_offsets) / (2 * sizeof(hsize_t)), dense_offsets, ref, ref_nbytes) < 0)
+        FAIL_PUTS_ERROR("    wrong chunks read with one walk of the chunk index.")
+    if(check_read_chunks(dsid, sizeof(sparse_offsets) / (2 * sizeof(hsize_t)), sparse_offsets, ref, ref_nbytes) < 0)
+        FAIL_PUTS_ERROR("    wrong chunks read with a lookup per chunk.")
+    if(check_read_chunks(dsid, (size_t)READ_CHUNKS_NCHUNKS, all_offsets, ref, ref_nbytes) < 0)
+        FAIL_PUTS_ERROR("    wrong chunks read for the whole dataset.")
+
+    /* An offset must be on a chunk boundary */
+    H5E_BEGIN_TRY {
+        ret = H5Dread_chunks(dsid, H5P_DEFAULT, (size_t)1, bad_offset, filters, nbytes, NULL);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("    chunk offset not on a chunk boundary accepted.")
+
+    /* Read the chunks again after reopening the file */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if((fid = H5Fopen(filename, H5F_ACC_RDONLY, fapl)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(check_read_chunks(dsid, sizeof(dense_offsets) / (2 * sizeof(hsize_t)), dense_offsets, ref, ref_nbytes) < 0)
+        FAIL_PUTS_ERROR("    wrong chunks read after reopening the file.")
+
+    /* Close */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dxpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dxpl);
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_read_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_write_chunks
+ *
+ * Purpose: Tests writing several raw chunks at once with H5Dwrite_chunks(),
+ *          for new chunks, chunks overwritten with the same and with a
+ *          different size, and chunks given in any order.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define WRITE_CHUNKS_CROWS      (READ_CHUNKS_DIM1 / READ_CHUNKS_CDIM1)
+#define WRITE_CHUNKS_CELMTS     (READ_CHUNKS_CDIM0 * READ_CHUNKS_CDIM1)
+static herr_t
+test_write_chunks(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hid_t       dsid2 = -1;     /* Dataset ID */
+    hsize_t     dims[2] = {READ_CHUNKS_DIM0, READ_CHUNKS_DIM1};
+    hsize_t     chunk_dims[2] = {READ_CHUNKS_CDIM0, READ_CHUNKS_CDIM1};
+    hsize_t     offsets[2 * READ_CHUNKS_NCHUNKS];
+    hsize_t     nbytes[READ_CHUNKS_NCHUNKS];
+    hsize_t     bad_offset[2] = {0, 2};
+    hsize_t     sizes[READ_CHUNKS_NCHUNKS];
+    uint32_t    filters[READ_CHUNKS_NCHUNKS];
+    uint32_t    rfilters[READ_CHUNKS_NCHUNKS];
+    const void *bufs[READ_CHUNKS_NCHUNKS];
+    void       *rbufs[READ_CHUNKS_NCHUNKS];
+    unsigned char filtered[READ_CHUNKS_NCHUNKS][READ_CHUNKS_BUF_SIZE];
+    int         chunks[READ_CHUNKS_NCHUNKS][WRITE_CHUNKS_CELMTS];
+    int         expect[READ_CHUNKS_DIM0][READ_CHUNKS_DIM1];
+    int         rbuf[READ_CHUNKS_DIM0][READ_CHUNKS_DIM1];
+    int         wbuf[READ_CHUNKS_DIM0][READ_CHUNKS_DIM1];
+    herr_t      ret;
+    unsigned    u, v, n;
+
+    TESTING("writing several raw chunks at once");
+
+    /* The contents of each chunk, unfiltered, and of the whole dataset */
+    for(u = 0; u < READ_CHUNKS_DIM0; u++)
+        for(v = 0; v < READ_CHUNKS_DIM1; v++) {
+            wbuf[u][v] = (int)(u * READ_CHUNKS_DIM1 + v) + 1;
+            chunks[(u / READ_CHUNKS_CDIM0) * WRITE_CHUNKS_CROWS + v / READ_CHUNKS_CDIM1][(u % READ_CHUNKS_CDIM0) * READ_CHUNKS_CDIM1 + v % READ_CHUNKS_CDIM1] = wbuf[u][v];
+        } /* end for */
+    HDmemset(expect, 0, sizeof(expect));
+
+    /* Create a filtered dataset, and another with the same data written
+     * normally, for the filtered chunks
+     */
+    h5_fixname(FILENAME[32], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if((dsid2 = H5Dcreate2(fid, "filtered", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid2, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < READ_CHUNKS_NCHUNKS; u++) {
+        offsets[2 * u] = (u / WRITE_CHUNKS_CROWS) * READ_CHUNKS_CDIM0;
+        offsets[2 * u + 1] = (u % WRITE_CHUNKS_CROWS) * READ_CHUNKS_CDIM1;
+        rbufs[u] = filtered[u];
+    } /* end for */
+    if(H5Dread_chunks(dsid2, H5P_DEFAULT, (size_t)READ_CHUNKS_NCHUNKS, offsets, rfilters, nbytes, rbufs) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid2) < 0) FAIL_STACK_ERROR
+
+    /* Write the first half of the chunks backwards, with the filters
+     * skipped
+     */
+    for(u = 0, n = READ_CHUNKS_NCHUNKS / 2; u < n; u++) {
+        unsigned idx = n - 1 - u;
+
+        offsets[2 * u] = (idx / WRITE_CHUNKS_CROWS) * READ_CHUNKS_CDIM0;
+        offsets[2 * u + 1] = (idx % WRITE_CHUNKS_CROWS) * READ_CHUNKS_CDIM1;
+        filters[u] = 0x3;
+        sizes[u] = sizeof(chunks[idx]);
+        bufs[u] = chunks[idx];
+        for(v = 0; v < READ_CHUNKS_CDIM0; v++)
+            HDmemcpy(&expect[offsets[2 * u] + v][offsets[2 * u + 1]], &wbuf[offsets[2 * u] + v][offsets[2 * u + 1]], READ_CHUNKS_CDIM1 * sizeof(int));
+    } /* end for */
+    if(H5Dwrite_chunks(dsid, H5P_DEFAULT, (size_t)n, offsets, filters, sizes, bufs) < 0) FAIL_STACK_ERROR
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(rbuf, expect, sizeof(rbuf)))
+        FAIL_PUTS_ERROR("    wrong data after writing new chunks.")
+
+    /* Overwrite every third chunk of the first half, with the filters
+     * applied, which changes their size, and every other chunk of the
+     * second half, alternately with and without the filters
+     */
+    for(u = 0, n = 0; u < READ_CHUNKS_NCHUNKS; u += (u < READ_CHUNKS_NCHUNKS / 2 ? 3 : 2), n++) {
+        offsets[2 * n] = (u / WRITE_CHUNKS_CROWS) * READ_CHUNKS_CDIM0;
+        offsets[2 * n + 1] = (u % WRITE_CHUNKS_CROWS) * READ_CHUNKS_CDIM1;
+        if(u < READ_CHUNKS_NCHUNKS / 2 || (n % 2)) {
+            filters[n] = 0;
+            sizes[n] = nbytes[u];
+            bufs[n] = filtered[u];
+        } /* end if */
+        else {
+            filters[n] = 0x3;
+            sizes[n] = sizeof(chunks[u]);
+            bufs[n] = chunks[u];
+        } /* end else */
+        for(v = 0; v < READ_CHUNKS_CDIM0; v++)
+            HDmemcpy(&expect[offsets[2 * n] + v][offsets[2 * n + 1]], &wbuf[offsets[2 * n] + v][offsets[2 * n + 1]], READ_CHUNKS_CDIM1 * sizeof(int));
+    } /* end for */
+    if(H5Dwrite_chunks(dsid, H5P_DEFAULT, (size_t)n, offsets, filters, sizes, bufs) < 0) FAIL_STACK_ERROR
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(rbuf, expect, sizeof(rbuf)))
+        FAIL_PUTS_ERROR("    wrong data after overwriting chunks.")
+
+    /* The chunk sizes and filter masks are those written */
+    if(H5Dread_chunks(dsid, H5P_DEFAULT, (size_t)n, offsets, rfilters, nbytes, NULL) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < n; u++)
+        if(rfilters[u] != filters[u] || nbytes[u] != sizes[u])
+            FAIL_PUTS_ERROR("    wrong chunk size or filter mask written.")
+
+    /* A chunk may only be written once, and the offsets must be on chunk
+     * boundaries
+     */
+    offsets[2] = offsets[0];
+    offsets[3] = offsets[1];
+    H5E_BEGIN_TRY {
+        ret = H5Dwrite_chunks(dsid, H5P_DEFAULT, (size_t)2, offsets, filters, sizes, bufs);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("    chunk written twice in one call.")
+    H5E_BEGIN_TRY {
+        ret = H5Dwrite_chunks(dsid, H5P_DEFAULT, (size_t)1, bad_offset, filters, sizes, bufs);
+    } H5E_END_TRY;
+    if(ret >= 0)
+        FAIL_PUTS_ERROR("    chunk offset not on a chunk boundary accepted.")
+
+    /* Check the data after reopening the file */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+    if((fid = H5Fopen(filename, H5F_ACC_RDWR, fapl)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset", H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(rbuf, expect, sizeof(rbuf)))
+        FAIL_PUTS_ERROR("    wrong data after reopening the file.")
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+
+    /* Write all the chunks of an unfiltered dataset with space allocated
+     * early twice, in place the second time
+     */
+    if(H5Premove_filter(dcpl, H5Z_FILTER_ALL) < 0) FAIL_STACK_ERROR
+    if(H5Pset_alloc_time(dcpl, H5D_ALLOC_TIME_EARLY) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "plain", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    for(n = 0; n < 2; n++) {
+        for(u = 0; u < READ_CHUNKS_NCHUNKS; u++) {
+            unsigned idx = (u * 5) % READ_CHUNKS_NCHUNKS;
+
+            offsets[2 * u] = (idx / WRITE_CHUNKS_CROWS) * READ_CHUNKS_CDIM0;
+            offsets[2 * u + 1] = (idx % WRITE_CHUNKS_CROWS) * READ_CHUNKS_CDIM1;
+            filters[u] = 0;
+            sizes[u] = sizeof(chunks[idx]);
+            bufs[u] = chunks[idx];
+        } /* end for */
+        if(H5Dwrite_chunks(dsid, H5P_DEFAULT, (size_t)READ_CHUNKS_NCHUNKS, offsets, filters, sizes, bufs) < 0) FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+        if(HDmemcmp(rbuf, wbuf, sizeof(rbuf)))
+            FAIL_PUTS_ERROR("    wrong data written to unfiltered dataset.")
+    } /* end for */
+
+    /* Close */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Dclose(dsid2);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_write_chunks() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_chunk_addr_cache
+ *
+ * Purpose: Tests the chunk address cache: that lookups of chunks read
+ *          before are answered from it when the chunk cache is disabled,
+ *          and that it doesn't return stale addresses after chunks are
+ *          reallocated or the dataset's extent changes.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define ADDR_CACHE_NBYTES       4096
+#define ADDR_CACHE_DIM1_EXT     (READ_CHUNKS_DIM1 + 2 * READ_CHUNKS_CDIM1)
+static herr_t
+test_chunk_addr_cache(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       dapl = -1;      /* Dataset access property list ID */
+    hid_t       dapl2 = -1;     /* Dataset access property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2] = {READ_CHUNKS_DIM0, READ_CHUNKS_DIM1};
+    hsize_t     max_dims[2] = {READ_CHUNKS_DIM0, H5S_UNLIMITED};
+    hsize_t     ext_dims[2] = {READ_CHUNKS_DIM0, ADDR_CACHE_DIM1_EXT};
+    hsize_t     chunk_dims[2] = {READ_CHUNKS_CDIM0, READ_CHUNKS_CDIM1};
+    hsize_t     offsets[2 * READ_CHUNKS_NCHUNKS];
+    hsize_t     sizes[READ_CHUNKS_NCHUNKS];
+    uint32_t    filters[READ_CHUNKS_NCHUNKS];
+    const void *bufs[READ_CHUNKS_NCHUNKS];
+    int         chunks[READ_CHUNKS_NCHUNKS][WRITE_CHUNKS_CELMTS];
+    int         wbuf[READ_CHUNKS_DIM0][READ_CHUNKS_DIM1];
+    int         rbuf[READ_CHUNKS_DIM0][READ_CHUNKS_DIM1];
+    int         ext_rbuf[READ_CHUNKS_DIM0][ADDR_CACHE_DIM1_EXT];
+    size_t      nbytes;
+    size_t      nused;
+    unsigned    nhits;
+    unsigned    u, v, n;
+
+    TESTING("chunk address cache");
+
+    for(u = 0; u < READ_CHUNKS_DIM0; u++)
+        for(v = 0; v < READ_CHUNKS_DIM1; v++)
+            wbuf[u][v] = (int)(u * READ_CHUNKS_DIM1 + v) + 1;
+
+    /* Check the default size */
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_addr_cache(dapl, &nbytes) < 0) FAIL_STACK_ERROR
+    if(nbytes != 64 * 1024)
+        FAIL_PUTS_ERROR("    wrong default chunk address cache size.")
+
+    /* Disable the chunk cache, so that every chunk read is looked up */
+    if(H5Pset_chunk_cache(dapl, H5D_CHUNK_CACHE_NSLOTS_DEFAULT, (size_t)0, H5D_CHUNK_CACHE_W0_DEFAULT) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_addr_cache(dapl, (size_t)ADDR_CACHE_NBYTES) < 0) FAIL_STACK_ERROR
+
+    /* Create a filtered dataset that can be extended */
+    h5_fixname(FILENAME[33], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if(H5Pset_shuffle(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pset_fletcher32(dcpl) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, max_dims)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, dapl)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    /* The size is retrieved with the dataset's access property list */
+    if((dapl2 = H5Dget_access_plist(dsid)) < 0) FAIL_STACK_ERROR
+    if(H5Pget_chunk_addr_cache(dapl2, &nbytes) < 0) FAIL_STACK_ERROR
+    if(nbytes != ADDR_CACHE_NBYTES)
+        FAIL_PUTS_ERROR("    wrong chunk address cache size for dataset.")
+    if(H5Pclose(dapl2) < 0) FAIL_STACK_ERROR
+
+    /* Reading the dataset again finds the chunks in the address cache */
+    for(n = 0; n < 2; n++) {
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+        if(HDmemcmp(rbuf, wbuf, sizeof(rbuf)))
+            FAIL_PUTS_ERROR("    wrong data read.")
+    } /* end for */
+    if(H5D__chunk_addr_cache_test(dsid, &nused, &nhits) < 0) FAIL_STACK_ERROR
+    if(0 == nused || 0 == nhits)
+        FAIL_PUTS_ERROR("    chunk address cache not used.")
+
+    /* Overwrite the first half of the chunks unfiltered, which moves them
+     * in the file
+     */
+    for(u = 0, n = READ_CHUNKS_NCHUNKS / 2; u < n; u++) {
+        offsets[2 * u] = (u / WRITE_CHUNKS_CROWS) * READ_CHUNKS_CDIM0;
+        offsets[2 * u + 1] = (u % WRITE_CHUNKS_CROWS) * READ_CHUNKS_CDIM1;
+        for(v = 0; v < WRITE_CHUNKS_CELMTS; v++) {
+            hsize_t row = offsets[2 * u] + v / READ_CHUNKS_CDIM1;
+            hsize_t col = offsets[2 * u + 1] + v % READ_CHUNKS_CDIM1;
+
+            wbuf[row][col] = -wbuf[row][col];
+            chunks[u][v] = wbuf[row][col];
+        } /* end for */
+        filters[u] = 0x3;
+        sizes[u] = sizeof(chunks[u]);
+        bufs[u] = chunks[u];
+    } /* end for */
+    if(H5Dwrite_chunks(dsid, H5P_DEFAULT, (size_t)n, offsets, filters, sizes, bufs) < 0) FAIL_STACK_ERROR
+    HDmemset(rbuf, 0, sizeof(rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+    if(HDmemcmp(rbuf, wbuf, sizeof(rbuf)))
+        FAIL_PUTS_ERROR("    wrong data read after overwriting chunks.")
+
+    /* Extending the dataset changes the chunks' linear indices, the new
+     * chunks must read as fill values
+     */
+    if(H5Dset_extent(dsid, ext_dims) < 0) FAIL_STACK_ERROR
+    HDmemset(ext_rbuf, 0xff, sizeof(ext_rbuf));
+    if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, ext_rbuf) < 0) FAIL_STACK_ERROR
+    for(u = 0; u < READ_CHUNKS_DIM0; u++)
+        for(v = 0; v < ADDR_CACHE_DIM1_EXT; v++)
+            if(ext_rbuf[u][v] != (v < READ_CHUNKS_DIM1 ? wbuf[u][v] : 0))
+                FAIL_PUTS_ERROR("    wrong data read after extending dataset.")
+
+    /* Shrink the dataset back, then check that nothing is cached when the
+     * address cache is disabled
+     */
+    if(H5Dset_extent(dsid, dims) < 0) FAIL_STACK_ERROR
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk_addr_cache(dapl, (size_t)0) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dopen2(fid, "dset", dapl)) < 0) FAIL_STACK_ERROR
+    for(n = 0; n < 2; n++) {
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+        if(HDmemcmp(rbuf, wbuf, sizeof(rbuf)))
+            FAIL_PUTS_ERROR("    wrong data read with address cache disabled.")
+    } /* end for */
+    if(H5D__chunk_addr_cache_test(dsid, &nused, &nhits) < 0) FAIL_STACK_ERROR
+    if(0 != nused || 0 != nhits)
+        FAIL_PUTS_ERROR("    disabled chunk address cache used.")
+
+    /* Close */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dapl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Pclose(dapl);
+        H5Pclose(dapl2);
+        H5Dclose(dsid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_chunk_addr_cache() */
+
+
+/*-------------------------------------------------------------------------
+ * Function: test_regular_chunk_map
+ *
+ * Purpose: Tests reading & writing regular hyperslab selections of a
+ *          chunked dataset, with the selections in each chunk worked
+ *          out as the chunks are visited, and a selection that needs
+ *          the full chunk map.
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ *-------------------------------------------------------------------------
+ */
+#define REG_MAP_DIM0            22
+#define REG_MAP_DIM1            28
+#define REG_MAP_CDIM0           4
+#define REG_MAP_CDIM1           5
+#define REG_MAP_NCASES          5
+static herr_t
+test_regular_chunk_map(hid_t fapl)
+{
+    char        filename[FILENAME_BUF_SIZE];
+    hid_t       fid = -1;       /* File ID */
+    hid_t       dcpl = -1;      /* Dataset creation property list ID */
+    hid_t       sid = -1;       /* Dataspace ID */
+    hid_t       msid = -1;      /* Memory dataspace ID */
+    hid_t       dsid = -1;      /* Dataset ID */
+    hsize_t     dims[2] = {REG_MAP_DIM0, REG_MAP_DIM1};
+    hsize_t     chunk_dims[2] = {REG_MAP_CDIM0, REG_MAP_CDIM1};
+    hsize_t     mdims[2];
+    /* The selections: one block across chunks in a dimension, the chunk
+     * size a multiple of the stride, the stride a multiple of the chunk
+     * size, blocks crossing chunk boundaries and a single block (which
+     * aren't done lazily)
+     */
+    hsize_t     start[REG_MAP_NCASES][2] = {{1, 2}, {1, 0}, {1, 1}, {0, 0}, {1, 2}};
+    hsize_t     stride[REG_MAP_NCASES][2] = {{21, 10}, {2, 5}, {8, 10}, {3, 3}, {21, 26}};
+    hsize_t     count[REG_MAP_NCASES][2] = {{1, 3}, {10, 6}, {3, 3}, {7, 9}, {1, 1}};
+    hsize_t     block[REG_MAP_NCASES][2] = {{21, 3}, {1, 3}, {2, 3}, {2, 2}, {21, 26}};
+    int         wbuf[REG_MAP_DIM0][REG_MAP_DIM1];
+    int         rbuf[REG_MAP_DIM0][REG_MAP_DIM1];
+    int         sel_buf[REG_MAP_DIM0 * REG_MAP_DIM1];
+    unsigned    i, u, v, n;
+
+    TESTING("regular hyperslab selections of chunks");
+
+    for(u = 0; u < REG_MAP_DIM0; u++)
+        for(v = 0; v < REG_MAP_DIM1; v++)
+            wbuf[u][v] = (int)(u * REG_MAP_DIM1 + v) + 1;
+
+    /* Create the dataset, its size isn't a multiple of the chunk size */
+    h5_fixname(FILENAME[34], fapl, filename, sizeof filename);
+    if((fid = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl)) < 0) FAIL_STACK_ERROR
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0) FAIL_STACK_ERROR
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0) FAIL_STACK_ERROR
+    if((sid = H5Screate_simple(2, dims, NULL)) < 0) FAIL_STACK_ERROR
+    if((dsid = H5Dcreate2(fid, "dset", H5T_NATIVE_INT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT)) < 0) FAIL_STACK_ERROR
+    if(H5Dwrite(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0) FAIL_STACK_ERROR
+
+    for(i = 0; i < REG_MAP_NCASES; i++) {
+        if(H5Sselect_hyperslab(sid, H5S_SELECT_SET, start[i], stride[i], count[i], block[i]) < 0) FAIL_STACK_ERROR
+
+        /* Read the selection into a buffer that holds just the elements */
+        mdims[0] = count[i][0] * block[i][0];
+        mdims[1] = count[i][1] * block[i][1];
+        if((msid = H5Screate_simple(2, mdims, NULL)) < 0) FAIL_STACK_ERROR
+        HDmemset(sel_buf, 0, sizeof(sel_buf));
+        if(H5Dread(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, sel_buf) < 0) FAIL_STACK_ERROR
+        for(u = 0; u < mdims[0]; u++)
+            for(v = 0; v < mdims[1]; v++) {
+                hsize_t row = start[i][0] + (u / block[i][0]) * stride[i][0] + u % block[i][0];
+                hsize_t col = start[i][1] + (v / block[i][1]) * stride[i][1] + v % block[i][1];
+
+                if(sel_buf[u * mdims[1] + v] != wbuf[row][col])
+                    FAIL_PUTS_ERROR("    wrong data read into contiguous buffer.")
+            } /* end for */
+
+        /* Write the selection back negated */
+        for(n = 0; n < mdims[0] * mdims[1]; n++)
+            sel_buf[n] = -sel_buf[n];
+        if(H5Dwrite(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, sel_buf) < 0) FAIL_STACK_ERROR
+        for(u = 0; u < mdims[0]; u++)
+            for(v = 0; v < mdims[1]; v++) {
+                hsize_t row = start[i][0] + (u / block[i][0]) * stride[i][0] + u % block[i][0];
+                hsize_t col = start[i][1] + (v / block[i][1]) * stride[i][1] + v % block[i][1];
+
+                wbuf[row][col] = -wbuf[row][col];
+            } /* end for */
+        if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+
+        /* Read the selection into the same selection of a buffer the size
+         * of the dataset
+         */
+        if((msid = H5Scopy(sid)) < 0) FAIL_STACK_ERROR
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread(dsid, H5T_NATIVE_INT, msid, sid, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+        if(H5Sclose(msid) < 0) FAIL_STACK_ERROR
+        if(H5Sselect_all(sid) < 0) FAIL_STACK_ERROR
+        for(u = 0; u < REG_MAP_DIM0; u++)
+            for(v = 0; v < REG_MAP_DIM1; v++) {
+                htri_t selected = (u >= start[i][0] && (u - start[i][0]) % stride[i][0] < block[i][0]
+                        && (u - start[i][0]) / stride[i][0] < count[i][0]
+                        && v >= start[i][1] && (v - start[i][1]) % stride[i][1] < block[i][1]
+                        && (v - start[i][1]) / stride[i][1] < count[i][1]);
+
+                if(rbuf[u][v] != (selected ? wbuf[u][v] : 0))
+                    FAIL_PUTS_ERROR("    wrong data read into strided buffer.")
+            } /* end for */
+
+        /* Check the whole dataset */
+        HDmemset(rbuf, 0, sizeof(rbuf));
+        if(H5Dread(dsid, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0) FAIL_STACK_ERROR
+        if(HDmemcmp(rbuf, wbuf, sizeof(rbuf)))
+            FAIL_PUTS_ERROR("    wrong data written.")
+    } /* end for */
+
+    /* Close */
+    if(H5Dclose(dsid) < 0) FAIL_STACK_ERROR
+    if(H5Sclose(sid) < 0) FAIL_STACK_ERROR
+    if(H5Pclose(dcpl) < 0) FAIL_STACK_ERROR
+    if(H5Fclose(fid) < 0) FAIL_STACK_ERROR
+
+    PASSED();
+    return 0;
+
+error:
+    H5E_BEGIN_TRY {
+        H5Pclose(dcpl);
+        H5Dclose(dsid);
+        H5Sclose(msid);
+        H5Sclose(sid);
+        H5Fclose(fid);
+    } H5E_END_TRY;
+    return -1;
+} /* end test_regular_chunk_map() */
+
 
 /*-------------------------------------------------------------------------
  * Function:    test_big_chunks_bypass_cache
@@ -12888,6 +14530,16 @@ main(void)
 
             nerrors += (test_huge_chunks(my_fapl) < 0        ? 1 : 0);
             nerrors += (test_chunk_cache(my_fapl) < 0        ? 1 : 0);
+            nerrors += (test_shared_chunk_cache(my_fapl) < 0 ? 1 : 0);
+            nerrors += (test_chunk_cache_policy(my_fapl) < 0 ? 1 : 0);
+            nerrors += (test_chunk_cache_hash(my_fapl) < 0   ? 1 : 0);
+            nerrors += (test_filter_nthreads(my_fapl) < 0    ? 1 : 0);
+            nerrors += (test_filter_nthreads_write(my_fapl) < 0 ? 1 : 0);
+            nerrors += (test_chunk_prefetch(my_fapl) < 0     ? 1 : 0);
+            nerrors += (test_read_chunks(my_fapl) < 0        ? 1 : 0);
+            nerrors += (test_write_chunks(my_fapl) < 0       ? 1 : 0);
+            nerrors += (test_chunk_addr_cache(my_fapl) < 0   ? 1 : 0);
+            nerrors += (test_regular_chunk_map(my_fapl) < 0  ? 1 : 0);
             nerrors += (test_big_chunks_bypass_cache(my_fapl) < 0   ? 1 : 0);
             nerrors += (test_chunk_fast(envval, my_fapl) < 0    ? 1 : 0);
             nerrors += (test_reopen_chunk_fast(my_fapl) < 0        ? 1 : 0);
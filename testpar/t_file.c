@@ -667,7 +667,7 @@ open_file(const char *filename, hid_t fapl, int metadata_write_strategy,
     /* flush invalidate each ring, starting from the outermost ring and
      * working inward.
      */
-    for ( i = 0; i < H5C__HASH_TABLE_LEN; i++ ) {
+    for ( i = 0; i < (int)cache_ptr->index_nbuckets; i++ ) {
         H5C_cache_entry_t * entry_ptr = NULL;
 
         entry_ptr = cache_ptr->index[i];
@@ -29,6 +29,7 @@ add_test (
     COMMAND    ${CMAKE_COMMAND}
         -E remove
         chunk.h5
+        chunk_map.h5
         iopipe.h5
         iopipe.raw
         x-diag-rd.dat
@@ -40,6 +41,8 @@ add_test (
         h5perf_serial.txt.err
         chunk.txt
         chunk.txt.err
+        chunk_map.txt
+        chunk_map.txt.err
         iopipe.txt
         iopipe.txt.err
         overhead.txt
@@ -89,6 +92,21 @@ else ()
 endif ()
 set_tests_properties (PERFORM_chunk PROPERTIES DEPENDS "PERFORM_h5perform-clearall-objects")
 
+if (HDF5_ENABLE_USING_MEMCHECKER)
+  add_test (NAME PERFORM_chunk_map COMMAND $<TARGET_FILE:chunk_map>)
+else ()
+  add_test (NAME PERFORM_chunk_map COMMAND "${CMAKE_COMMAND}"
+      -D "TEST_PROGRAM=$<TARGET_FILE:chunk_map>"
+      -D "TEST_ARGS:STRING="
+      -D "TEST_EXPECT=0"
+      -D "TEST_SKIP_COMPARE=TRUE"
+      -D "TEST_OUTPUT=chunk_map.txt"
+      -D "TEST_FOLDER=${PROJECT_BINARY_DIR}"
+      -P "${HDF_RESOURCES_EXT_DIR}/runTest.cmake"
+  )
+endif ()
+set_tests_properties (PERFORM_chunk_map PROPERTIES DEPENDS "PERFORM_h5perform-clearall-objects")
+
 if (HDF5_ENABLE_USING_MEMCHECKER)
   add_test (NAME PERFORM_iopipe COMMAND $<TARGET_FILE:iopipe>)
 else ()
@@ -71,6 +71,12 @@
 /* #define DIAG_W0		0.65F */
 /* #define DIAG_NRDCC		521 */
 
+/* Mixed hot-set and scan test */
+#define MIX_CACHE	25		/*cache size in chunks		*/
+#define MIX_HOT		10		/*hot set size in chunks	*/
+#define MIX_SCAN	20		/*chunks scanned between hot accesses */
+#define MIX_ROUNDS	50		/*number of hot-set/scan rounds	*/
+
 static size_t	nio_g;
 static hid_t	fapl_g = -1;
 
@@ -321,6 +327,74 @@ test_diag (int op, size_t cache_size, size_t io_size, size_t offset)
     return (double)nio/(double)nio_g;
 }
 
+
+/*-------------------------------------------------------------------------
+ * Function:	test_mixed
+ *
+ * Purpose:	Mixes a hot set of chunks that an application keeps reading
+ *		with a sequential scan over the rest of the dataset, as when
+ *		an analysis job runs next to an ingest process.  Each round
+ *		reads every hot chunk once and then the next MIX_SCAN chunks
+ *		of the scan, one chunk per request.
+ *
+ * Return:	Hit rate: fraction of chunk requests satisfied by the raw
+ *		data chunk cache.
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+test_mixed (H5D_chunk_cache_policy_t policy, size_t cache_size)
+{
+    hid_t	file, dapl, dset, mem_space, file_space;
+    signed char	*buf = (signed char *)calloc(1, (size_t)(SQUARE(CH_SIZE)));
+    hsize_t	hs_size[2];
+    hsize_t	hs_offset[2];
+    size_t	round, u, scan = MIX_HOT, nreq = 0;
+
+    dapl = H5Pcreate (H5P_DATASET_ACCESS);
+    H5Pset_chunk_cache (dapl, (size_t)RM_NRDCC, cache_size*SQUARE (CH_SIZE),
+			H5D_CHUNK_CACHE_W0_DEFAULT);
+    H5Pset_chunk_cache_policy (dapl, policy);
+    file = H5Fopen(FILE_NAME, H5F_ACC_RDONLY, fapl_g);
+    dset = H5Dopen2(file, "dset", dapl);
+    file_space = H5Dget_space(dset);
+    hs_size[0] = hs_size[1] = CH_SIZE;
+    mem_space = H5Screate_simple (2, hs_size, hs_size);
+    nio_g = 0;
+
+    for (round=0; round<MIX_ROUNDS; round++) {
+	/* The hot set is the first MIX_HOT chunks, the scan goes over the
+	 * remaining chunks in row-major order and wraps around */
+	for (u=0; u<MIX_HOT+MIX_SCAN; u++) {
+	    size_t chunk;
+
+	    if (u<MIX_HOT) {
+		chunk = u;
+	    } else {
+		chunk = scan;
+		if (++scan == SQUARE(DS_SIZE)) scan = MIX_HOT;
+	    }
+	    hs_offset[0] = (chunk / DS_SIZE) * CH_SIZE;
+	    hs_offset[1] = (chunk % DS_SIZE) * CH_SIZE;
+	    H5Sselect_hyperslab (file_space, H5S_SELECT_SET, hs_offset,
+				 NULL, hs_size, NULL);
+	    H5Dread (dset, H5T_NATIVE_SCHAR, mem_space, file_space,
+		     H5P_DEFAULT, buf);
+	    nreq++;
+	}
+    }
+
+    free (buf);
+    H5Sclose (mem_space);
+    H5Sclose (file_space);
+    H5Dclose (dset);
+    H5Pclose (dapl);
+    H5Fclose (file);
+
+    /* Every miss runs the counter filter over one chunk */
+    return 1.0 - (double)(nio_g/SQUARE(CH_SIZE))/(double)nreq;
+}
+
 
 /*-------------------------------------------------------------------------
  * Function:	main
@@ -540,6 +614,21 @@ main (void)
     fprintf (f, "pause -1\n");
 #endif
 
+#if 1
+    /*
+     * Test a hot set of chunks mixed with a scan, for each chunk cache
+     * replacement policy.
+     */
+    printf("\nTest      %8s %8s %8s\n", "CacheSz", "HotSz",  "HitRate");
+    printf("--------- -------- -------- --------\n");
+    printf ("Mixed-LRU %8d %8d", MIX_CACHE, MIX_HOT);
+    fflush (stdout);
+    printf (" %8.2f\n", test_mixed (H5D_CHUNK_CACHE_POLICY_LRU, MIX_CACHE));
+    printf ("Mixed-2Q  %8d %8d", MIX_CACHE, MIX_HOT);
+    fflush (stdout);
+    printf (" %8.2f\n", test_mixed (H5D_CHUNK_CACHE_POLICY_2Q, MIX_CACHE));
+#endif
+
 
     H5Pclose (fapl_g);
     fclose (f);
@@ -0,0 +1,199 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *
+ * Copyright by The HDF Group.                                               *
+ * All rights reserved.                                                      *
+ *                                                                           *
+ * This file is part of HDF5.  The full HDF5 copyright notice, including     *
+ * terms governing use, modification, and redistribution, is contained in    *
+ * the COPYING file, which can be found at the root of the source code       *
+ * distribution tree, or in https://support.hdfgroup.org/ftp/HDF5/releases.  *
+ * If you do not have access to either file, you may request a copy from     *
+ * help@hdfgroup.org.                                                        *
+ * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+/*
+ * Purpose:	Measures the time taken to read & write regular hyperslab
+ *		selections that cover many small chunks.  Each selection is
+ *		transferred twice: with a memory dataspace of the same rank
+ *		as the dataset, where the selection in each chunk is worked
+ *		out as the chunk is visited, and with an equivalent memory
+ *		dataspace of a higher rank, which makes the library build a
+ *		map of all the chunks selected first.  The elements in memory
+ *		are the same, so the difference is the cost of the map.
+ *		Selections of a single block use the map both times.
+ */
+
+/* See H5private.h for how to include headers */
+#undef NDEBUG
+#include "hdf5.h"
+#include "H5private.h"
+
+#define FILE_NAME       "chunk_map.h5"
+#define DIM0            2048            /* Dataset size, in elements        */
+#define DIM1            2048
+#define CDIM0           16              /* Chunk size, in elements          */
+#define CDIM1           16
+#define NREPS           5               /* Transfers of each selection      */
+
+/* The selections tested */
+typedef struct sel_t {
+    const char *name;
+    hsize_t     start[2];
+    hsize_t     stride[2];
+    hsize_t     count[2];
+    hsize_t     block[2];
+} sel_t;
+
+static const sel_t sels_g[] = {
+    {"whole dataset", {0, 0}, {1, 1}, {1, 1}, {DIM0, DIM1}},
+    {"unaligned block", {5, 7}, {1, 1}, {1, 1}, {DIM0 - 10, DIM1 - 14}},
+    {"every other row", {0, 0}, {2, 1}, {DIM0 / 2, 1}, {1, DIM1}},
+    {"one block per chunk", {2, 2}, {CDIM0, CDIM1}, {DIM0 / CDIM0, DIM1 / CDIM1}, {4, 4}}
+};
+
+
+/*-------------------------------------------------------------------------
+ * Function:	elapsed
+ *
+ * Purpose:	Returns the seconds between two times.
+ *
+ * Return:	Seconds
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+elapsed(const struct timeval *t_start, const struct timeval *t_stop)
+{
+    return ((double)t_stop->tv_sec + (double)t_stop->tv_usec / 1000000.0F) -
+            ((double)t_start->tv_sec + (double)t_start->tv_usec / 1000000.0F);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	transfer
+ *
+ * Purpose:	Reads or writes the selection NREPS times.
+ *
+ * Return:	Seconds taken on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static double
+transfer(hid_t dset, hid_t file_space, hid_t mem_space, int *buf,
+    hbool_t do_write)
+{
+    struct timeval t_start, t_stop;
+    unsigned    u;
+
+    HDgettimeofday(&t_start, NULL);
+    for(u = 0; u < NREPS; u++) {
+        herr_t status;
+
+        if(do_write)
+            status = H5Dwrite(dset, H5T_NATIVE_INT, mem_space, file_space, H5P_DEFAULT, buf);
+        else
+            status = H5Dread(dset, H5T_NATIVE_INT, mem_space, file_space, H5P_DEFAULT, buf);
+        if(status < 0)
+            return -1.0F;
+    } /* end for */
+    HDgettimeofday(&t_stop, NULL);
+
+    return elapsed(&t_start, &t_stop);
+}
+
+
+/*-------------------------------------------------------------------------
+ * Function:	main
+ *
+ * Purpose:	Times the transfers of each selection.
+ *
+ * Return:	Success:	0
+ *
+ *		Failure:	1
+ *
+ *-------------------------------------------------------------------------
+ */
+int
+main(void)
+{
+    hid_t       file, dset, dcpl, dapl, file_space;
+    hsize_t     dims[2] = {DIM0, DIM1};
+    hsize_t     chunk_dims[2] = {CDIM0, CDIM1};
+    int        *buf, *check;
+    size_t      u, n;
+
+    if(NULL == (buf = (int *)HDmalloc(DIM0 * DIM1 * sizeof(int))))
+        return 1;
+    if(NULL == (check = (int *)HDmalloc(DIM0 * DIM1 * sizeof(int))))
+        return 1;
+    for(n = 0; n < DIM0 * DIM1; n++)
+        buf[n] = (int)n;
+
+    /* Create the dataset, with a chunk cache that holds all the chunks */
+    if((file = H5Fcreate(FILE_NAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        return 1;
+    if((dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        return 1;
+    if(H5Pset_chunk(dcpl, 2, chunk_dims) < 0)
+        return 1;
+    if((dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        return 1;
+    if(H5Pset_chunk_cache(dapl, (size_t)65521, (size_t)(2 * DIM0 * DIM1 * sizeof(int)), H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+        return 1;
+    if((file_space = H5Screate_simple(2, dims, NULL)) < 0)
+        return 1;
+    if((dset = H5Dcreate2(file, "dset", H5T_NATIVE_INT, file_space, H5P_DEFAULT, dcpl, dapl)) < 0)
+        return 1;
+    if(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        return 1;
+
+    HDfprintf(stdout, "%d x %d dataset of %d x %d chunks, %d transfers per test\n",
+            DIM0, DIM1, CDIM0, CDIM1, NREPS);
+    HDfprintf(stdout, "%-20s %-6s %12s %12s\n", "selection", "op", "lazy (s)", "map (s)");
+    for(u = 0; u < NELMTS(sels_g); u++) {
+        hsize_t mdims2[2], mdims3[3];
+        hid_t   mem_space2, mem_space3;
+        int     op;
+
+        if(H5Sselect_hyperslab(file_space, H5S_SELECT_SET, sels_g[u].start, sels_g[u].stride, sels_g[u].count, sels_g[u].block) < 0)
+            return 1;
+
+        /* The same elements in memory, as a 2-D and a 3-D dataspace */
+        mdims2[0] = mdims3[1] = sels_g[u].count[0] * sels_g[u].block[0];
+        mdims2[1] = mdims3[2] = sels_g[u].count[1] * sels_g[u].block[1];
+        mdims3[0] = 1;
+        if((mem_space2 = H5Screate_simple(2, mdims2, NULL)) < 0)
+            return 1;
+        if((mem_space3 = H5Screate_simple(3, mdims3, NULL)) < 0)
+            return 1;
+
+        for(op = 0; op < 2; op++) {
+            double t_lazy, t_map;
+
+            if((t_lazy = transfer(dset, file_space, mem_space2, buf, (hbool_t)op)) < 0)
+                return 1;
+            if((t_map = transfer(dset, file_space, mem_space3, (op ? buf : check), (hbool_t)op)) < 0)
+                return 1;
+            if(!op && HDmemcmp(buf, check, (size_t)(mdims2[0] * mdims2[1]) * sizeof(int)))
+                return 1;
+            HDfprintf(stdout, "%-20s %-6s %12.4f %12.4f\n", sels_g[u].name,
+                    (op ? "write" : "read"), t_lazy, t_map);
+        } /* end for */
+
+        H5Sclose(mem_space2);
+        H5Sclose(mem_space3);
+    } /* end for */
+
+    H5Sclose(file_space);
+    H5Dclose(dset);
+    H5Pclose(dapl);
+    H5Pclose(dcpl);
+    H5Fclose(file);
+    HDfree(buf);
+    HDfree(check);
+
+    if(!HDgetenv("HDF5_NOCLEANUP"))
+        HDremove(FILE_NAME);
+
+    return 0;
+}
+
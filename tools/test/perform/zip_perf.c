@@ -56,6 +56,7 @@ static char *filename=NULL;
 static int compress_percent = 0;
 static int compress_level = Z_DEFAULT_COMPRESSION;
 static int output, random_test = FALSE;
+static unsigned filter_nthreads = 0;
 static int report_once_flag;
 static double compression_time;
 
@@ -65,7 +66,7 @@ static void compress_buffer(Bytef *dest, uLongf *destLen, const Bytef *source,
                             uLong sourceLen);
 
 /* commandline options : long and short form */
-static const char *s_opts = "hB:b:c:p:rs:0123456789";
+static const char *s_opts = "hB:b:c:p:rs:t:0123456789";
 static struct long_options l_opts[] = {
     { "help", no_arg, 'h' },
     { "compressability", require_arg, 'c' },
@@ -125,6 +126,12 @@ static struct long_options l_opts[] = {
     { "rand", no_arg, 'r' },
     { "ran", no_arg, 'r' },
     { "ra", no_arg, 'r' },
+    { "threads", require_arg, 't' },
+    { "thread", require_arg, 't' },
+    { "threa", require_arg, 't' },
+    { "thre", require_arg, 't' },
+    { "thr", require_arg, 't' },
+    { "th", require_arg, 't' },
     { NULL, 0, '\0' }
 };
 
@@ -329,6 +336,9 @@ usage(void)
     HDfprintf(stdout, "     -p D, --prefix=D           The directory prefix to place the file\n");
     HDfprintf(stdout, "     -r, --random-test          Use random data to write to the file\n");
     HDfprintf(stdout, "                                [default: no]\n");
+    HDfprintf(stdout, "     -t N, --threads=N          Also write a deflated HDF5 dataset, once\n");
+    HDfprintf(stdout, "                                with one filter thread and once with N\n");
+    HDfprintf(stdout, "                                [default: no]\n");
     HDfprintf(stdout, "\n");
     HDfprintf(stdout, "  D  - a directory which exists\n");
     HDfprintf(stdout, "  P  - a number between 0 and 100\n");
@@ -433,6 +443,77 @@ fill_with_random_data(Bytef *src, uLongf src_len)
     }
 }
 
+/*
+ * Function:    write_dataset
+ * Purpose:     Write FILE_SIZE bytes of SRC to a deflated HDF5 dataset
+ *              chunked by SRC_LEN, with NTHREADS threads running the filter
+ *              pipeline. The chunk cache has room for the chunks compressed
+ *              in one batch, so the chunks are compressed as they are
+ *              preempted and when the dataset is closed.
+ * Return:      Time spent writing and closing the dataset, in seconds
+ */
+static double
+write_dataset(const Bytef *src, uLongf src_len, unsigned long file_size,
+              unsigned nthreads)
+{
+    hid_t file, space, dset, dcpl, dapl, mspace;
+    hsize_t dims[1], chunk_dims[1], start[1], count[1];
+    struct timeval timer_start, timer_stop;
+    unsigned long i, iters;
+
+    iters = file_size / src_len;
+    if (iters == 0)
+        iters = 1;
+    dims[0] = (hsize_t)src_len * iters;
+    chunk_dims[0] = (hsize_t)src_len;
+    count[0] = (hsize_t)src_len;
+
+    if ((file = H5Fcreate(filename, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT)) < 0 ||
+            (space = H5Screate_simple(1, dims, NULL)) < 0 ||
+            (mspace = H5Screate_simple(1, count, NULL)) < 0 ||
+            (dcpl = H5Pcreate(H5P_DATASET_CREATE)) < 0 ||
+            H5Pset_chunk(dcpl, 1, chunk_dims) < 0 ||
+            H5Pset_deflate(dcpl, (unsigned)(compress_level == Z_DEFAULT_COMPRESSION ? 6 : compress_level)) < 0 ||
+            (dapl = H5Pcreate(H5P_DATASET_ACCESS)) < 0 ||
+            H5Pset_chunk_cache(dapl, (size_t)521, (size_t)(2 * nthreads + 1) * src_len, H5D_CHUNK_CACHE_W0_DEFAULT) < 0 ||
+            H5Pset_chunk_flush_nthreads(dapl, nthreads) < 0 ||
+            (dset = H5Dcreate2(file, "zip_perf", H5T_NATIVE_UCHAR, space, H5P_DEFAULT, dcpl, dapl)) < 0) {
+        cleanup();
+        error("unable to create the dataset");
+    }
+
+    HDgettimeofday(&timer_start, NULL);
+
+    for (i = 0; i < iters; ++i) {
+        start[0] = (hsize_t)i * src_len;
+
+        if (H5Sselect_hyperslab(space, H5S_SELECT_SET, start, NULL, count, NULL) < 0 ||
+                H5Dwrite(dset, H5T_NATIVE_UCHAR, mspace, space, H5P_DEFAULT, src) < 0) {
+            cleanup();
+            error("unable to write the dataset");
+        }
+    }
+
+    if (H5Dclose(dset) < 0) {
+        cleanup();
+        error("unable to close the dataset");
+    }
+
+    HDgettimeofday(&timer_stop, NULL);
+
+    H5Pclose(dapl);
+    H5Pclose(dcpl);
+    H5Sclose(mspace);
+    H5Sclose(space);
+    H5Fclose(file);
+    HDunlink(filename);
+
+    return ((double)timer_stop.tv_sec +
+                ((double)timer_stop.tv_usec) / (double)MICROSECOND) -
+           ((double)timer_start.tv_sec +
+                ((double)timer_start.tv_usec) / (double)MICROSECOND);
+}
+
 static void
 do_write_test(unsigned long file_size, unsigned long min_buf_size,
               unsigned long max_buf_size)
@@ -538,6 +619,19 @@ do_write_test(unsigned long file_size, unsigned long min_buf_size,
         HDfprintf(stdout, "\tCompression Time: %gs\n", compression_time);
 
         HDunlink(filename);
+
+        /* do deflated HDF5 dataset writes */
+        if (filter_nthreads > 0) {
+            double serial_time = write_dataset(src, src_len, file_size, 1);
+
+            total_time = write_dataset(src, src_len, file_size, filter_nthreads);
+
+            HDfprintf(stdout, "\tDataset Write Time (1 thread): %.2fs\n", serial_time);
+            HDfprintf(stdout, "\tDataset Write Time (%u threads): %.2fs\n",
+                   filter_nthreads, total_time);
+            HDfprintf(stdout, "\tDataset Write Speedup: %.2fx\n",
+                   (fabs(total_time) < (double)0.0000000001F) ? (double)0.0F : serial_time / total_time);
+        }
         HDfree(src);
     }
 }
@@ -593,6 +687,9 @@ main(int argc, char **argv)
         case 's':
             file_size = parse_size_directive(opt_arg);
             break;
+        case 't':
+            filter_nthreads = (unsigned)HDstrtoul(opt_arg, NULL, 10);
+            break;
         case '?':
             usage();
             exit(EXIT_FAILURE);